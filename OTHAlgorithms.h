@@ -37,15 +37,37 @@ namespace OTH {
     
     ~Algorithms();
 
-    static double computeCLs(TH1 *pLLRsb,const TH1 *pLLRb,const double llr);
+    // CLs+b and CLb are also returned if pointers are given
+    static double computeCLs(TH1 *pLLRsb,const TH1 *pLLRb,const double llr,
+			     double *pCLsb=0,double *pCLb=0);
     
+    // search by scan and log-dichotomy (or extrapolation), running an OTH::LimitSearch to completion
     static double sigStrengthExclusion(Base &clgen,const double mu0,const double mu0Step,
 				       const int nbExp,const int type,double &cls,const double confLevel,
 				       const bool extrapol=false);
 
-    static double getCLsFromLLR(const int type,TH1 *pLLRsb,const TH1 *pLLRb);
+    // search based on a weighted fit of log(CLs) versus mu, using all evaluations
+    // the number of pseudo-experiments grows from nbExp/64 for coarse probes to at most nbExp near the limit,
+    // until the limit is known with the precision of a single evaluation with nbExp pseudo-experiments
+    // muErr is the resulting statistical uncertainty of the limit, cls the CLs of the fitted model at the
+    // returned limit (the CLs of the last evaluation if the search fails), the LLR distributions being
+    // the ones of the last evaluation, made at the previous fitted limit
+    static double sigStrengthExclusionFit(Base &clgen,const double mu0,const int nbExp,const int type,
+					  double &cls,double &muErr,const double confLevel);
+
+    static double getCLsFromLLR(const int type,TH1 *pLLRsb,const TH1 *pLLRb,
+				double *pCLsb=0,double *pCLb=0);
     
     static std::vector<double> getQuantiles(const TH1 *pExpMu,const bool print=true);
+
+    // confidence intervals at confidence level cl of the quantiles of getQuantiles, bounded by the
+    // order statistics of the nbEntries values filling the histogram (which may not be normalised)
+    static void getQuantileIntervals(const TH1 *pExpMu,const double nbEntries,const double cl,
+				     std::vector<double> &quantiles,std::vector<double> &low,std::vector<double> &high);
+
+    // linear convolution of two distributions, c[k]=sum_i a[i]*b[k-i] (size a.size()+b.size()-1),
+    // computed with a radix-2 FFT, negative round-off values being set to 0
+    static void convolve(const std::vector<double> &a,const std::vector<double> &b,std::vector<double> &c);
     
   };
 
@@ -21,6 +21,8 @@
 #ifndef OTH_BASE_H
 #define OTH_BASE_H
 
+#include <vector>
+
 class TH1;
 class TGraph;
 
@@ -51,12 +53,28 @@ namespace OTH {
     // (calls setSigStrength, generateDistrLLR and computeCLsData)
     // purely virtual function declared here for use in OTH::Algorithms
     virtual double generateForCLs(const double mu,const int nbExp,const int type) =0;
+
+    // computation of the CLs for the limit type from the LLR distributions already generated
+    virtual double computeCLsFromDistr(const int type) =0;
+
+    // generation of nbExp pseudo-experiments with the signal strength mu, the CLs of all
+    // the limit types being computed from the same LLR distributions (see OTH::LimitScheduler)
+    void generateForCLsTypes(const double mu,const int nbExp,const std::vector<int> &types,
+			     std::vector<double> &cls);
     
     // methods called for observed and expected (median, -+1 sigma, +-2 sigma) limit computation
     // type of limit is from the above enum
     virtual double sigStrengthExclusion(const LimitType type,const int nbExp,double &cls,
 					const double muHint=1,const OTH::MethType method=OTH::MethDichotomy)=0;
     
+    // statistical uncertainty (from pseudo-experiments) of the last signal strength computed with MethFit
+    // (negative if not available)
+    inline double getSigStrengthError() const {return m_sigStrengthError;}
+
+    // CLs+b and CLb corresponding to the last CLs computed by generateForCLs
+    inline double getLastCLsb() const {return m_lastCLsb;}
+    inline double getLastCLb() const {return m_lastCLb;}
+
     // methods called for observed and expected (median, -+1 sigma, +-2 sigma) significance computation
     std::pair<double,double> significance(const SignifType type,const int nbExp,const double mu=1);
 
@@ -81,8 +99,24 @@ namespace OTH {
 
     // get CLS as a function of mu
     inline TGraph *getCLsVsMu() const {return m_pCLsMu;}
+
+    // CLs evaluations since the beginning of the last limit search
+    struct TracePoint {
+      double mu;
+      int nbExp;
+      double cls,clb;
+    };
+    inline const std::vector<TracePoint> &getSearchTrace() const {return m_searchTrace;}
+
+    // deletes the histograms, graphs and stored values of the results, which are recreated by the
+    // following computations, e.g. when histograms are not owned by a ROOT directory
+    // (TH1::AddDirectory(false)), the pointers returned before becoming invalid
+    virtual void releaseMemory();
     
   protected:    
+
+    // keeps a CLs evaluation in the search trace (CLb from the last computation)
+    void traceCLs(const double mu,const int nbExp,const double cls);
     
     bool m_additiveSystComb; // true if combination type for systematics is additive
     
@@ -90,6 +124,10 @@ namespace OTH {
     TGraph *m_pMuObs,*m_pCLsMu; // mu_up vs obs, CLs vs mu_up
     
     double m_confLevel; // confidence level of computed limits
+
+    double m_sigStrengthError; // uncertainty of last computed signal strength
+    double m_lastCLsb,m_lastCLb; // last computed CLs+b and CLb
+    std::vector<TracePoint> m_searchTrace; // CLs evaluations of the last limit search
     
   private:
     Base(const Base&);
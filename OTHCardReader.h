@@ -0,0 +1,79 @@
+///////////////////////////////////////////////////////////////////////////////////
+// This file is part the software OpTHyLiC
+// Copyright © 2015 Laboratoire de Physique Corpusculaire de Clermont-Ferrand
+// Developpers: David Calvet, Emmanuel Busato, Timothée Theveneaux-Pelzer
+// Contact: opthylic@in2p3.fr
+//
+//     This program is free software: you can redistribute it and/or modify
+//     it under the terms of the GNU General Public License as published by
+//     the Free Software Foundation, either version 3 of the License, or
+//     (at your option) any later version.
+// 
+//     This program is distributed in the hope that it will be useful,
+//     but WITHOUT ANY WARRANTY; without even the implied warranty of
+//     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//     GNU General Public License for more details.
+// 
+//     You should have received a copy of the GNU General Public License
+//     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef OTH_CARDREADER_H
+#define OTH_CARDREADER_H
+
+#include <string>
+#include <vector>
+
+namespace OTH {
+
+  /// Tokenized content of a channel input file (see paper for syntax description)
+  // The whole file is read at once and split into lines without any stream per line,
+  // so that independent files can be read concurrently before building the channels.
+  class CardReader {
+
+  public:
+
+    enum {KwBkg, // +bg
+	  KwSig, // +sig
+	  KwData, // +data
+	  KwChannelNameLaTeX, // +nameLaTeX
+	  KwSyst, // .syst
+	  KwSampleNameLaTeX, // .nameLaTeX
+	  KwUnknown}; // anything else
+
+    struct Line {
+      int keyword;
+      std::string name; // second token
+      double val1,val2; // third and fourth tokens (second one for +data)
+      std::string text; // rest of the line for LaTeX names, full line if unknown
+    };
+
+    CardReader();
+
+    ~CardReader();
+
+    // read and tokenize file, returns false if it can not be opened
+    bool read(const std::string &fileName);
+
+    // tokenize content already in memory
+    void parse(const std::string &content);
+
+    inline const std::string &getFileName() const {return m_fileName;}
+    inline bool isOpened() const {return m_opened;}
+    // true if the file describes shapes stored in ROOT files
+    inline bool isShape() const {return m_shape;}
+    inline unsigned int getSize() const {return m_lines.size();}
+    inline const Line &getLine(const unsigned int i) const {return m_lines[i];}
+
+  private:
+    static double toDouble(const char *begin,const char *end,bool &ok);
+
+    std::string m_fileName;
+    bool m_opened;
+    bool m_shape;
+    std::vector<Line> m_lines;
+  };
+
+}
+
+#endif // OTH_CARDREADER_H
@@ -34,6 +34,8 @@ namespace OTH {
   class RdmGenerator;
   class Systematics;
   class PdfGenerator;
+  class ToyKernel;
+  class CardReader;
   
   class Channel: public Base {
 
@@ -51,6 +53,10 @@ namespace OTH {
 
     // setting of samples yields and uncertainties
     void addSamples(const std::string &fileName);
+    void addSamples(const CardReader &card);
+    // copy of the samples, systematic uncertainties and data of another channel
+    // (the systematic uncertainties are added in the same order, so that their indices are the same)
+    void addSamples(const Channel &channel);
     
     unsigned int addBkgSample(const std::string &name,const double nominal,const double stat);
     void addBkgSystematics(const unsigned int iSample,
@@ -60,6 +66,13 @@ namespace OTH {
     void setSigSample(const std::string &name,const double nominal,const double stat);
     void addSigSystematics(const std::string &systName,
 			   const double up,const double down);
+    // removal of the negligible systematic uncertainties of all samples (see OTH::Sample::pruneSysts),
+    // the ones still used being flagged in used (indexed as in OTH::Systematics), each removed one
+    // being reported to out, returns the number of removed ones and the largest relative decrease
+    // of the total uncertainty of a sample
+    unsigned int pruneSystematics(const double threshold,std::vector<bool> &used,double &maxEffect,std::ostream &out);
+    // new indices of the systematic uncertainties, after removal of the unused ones in OTH::Systematics
+    void reindexSystematics(const std::vector<unsigned int> &newIds);
     void setYieldData(const int obs) {m_yieldData=obs;}
     void setYieldDataToBkg() {m_yieldData=static_cast<int>(m_yieldBg);}
     int getYieldData() const {return m_yieldData;}
@@ -73,8 +86,22 @@ namespace OTH {
     // computation of the LLR value for the given number of observed events
     double computeLLR(const int obs) const;
     double computeLLRdata() const {return computeLLR(m_yieldData);}
+    // LLR for a non-integer number of events (the LLR is linear in the number of events)
+    double computeLLRYield(const double yield) const;
     void initDistrLLR(double &llrMin,double &llrMax);
     void generateSinglePseudoExp(double &llrB,double &llrSB);
+    // also returns the expected yields of the pseudo-experiment, before Poisson fluctuations
+    void generateSinglePseudoExp(double &llrB,double &llrSB,double &expectedB,double &expectedSB);
+    // adds the first order variations of the LLRs for the nominal yields of b and s+b
+    // with each systematic uncertainty (indexed as in OTH::Systematics)
+    void addLLRSystSlopes(std::vector<double> &slopesB,std::vector<double> &slopesSB) const;
+    // draws of a pseudo-experiment which do not depend on the signal strength (see OTH::ToyCache),
+    // for the current variations of the systematic uncertainties
+    void generateSingleDraws(double &expectedSig,int &countB,int &countBSB,double &uniform) const;
+    // pseudo-experiment for the current signal strength from these draws, the signal part of
+    // the s+b count being the poisson quantile of the uniform draw
+    void generateSinglePseudoExp(double &llrB,double &llrSB,const double expectedSig,
+				 const int countB,const int countBSB,const double uniform);
     
     // generation of nbExp pseudo-experiments to compute the LLR distributions
     // must be called before trying to compute any CLs or p-value
@@ -103,11 +130,42 @@ namespace OTH {
     // (calls setSigStrength, generateDistrLLR and computeCLs)
     virtual double generateForCLs(const double mu,const int nbExp,const int type);
 
+    // computation of the CLs for the limit type from the LLR distributions already generated
+    virtual double computeCLsFromDistr(const int type);
+
+    // deterministic count distributions (index=number of events) for b and mu*s+b, with at least nMin+1 counts,
+    // computed by quadrature over the systematic variations (Gauss-Legendre between -5,-1,0,1,5 sigmas)
+    // and over the statistical uncertainties of samples (exact for gamma distributions, Gauss-Hermite otherwise)
+    void computeDistrCounts(const double mu,std::vector<double> &distrB,std::vector<double> &distrSB,
+			    const int nMin=0) const;
+
+    // deterministic replacement of generateDistrLLR, filling the same histograms with exact probabilities
+    void computeDistrLLR();
+
+    // deterministic CLs for the signal strength mu, for the given type of limit
+    double computeCLsQuadrature(const double mu,const int type);
+
+    // number of quadrature nodes for each systematic uncertainty (per interval) and for each statistical uncertainty
+    inline void setQuadratureNodes(const int nbNodesSyst,const int nbNodesStat) {m_nbNodesSyst=nbNodesSyst; m_nbNodesStat=nbNodesStat;}
+
+    // Poisson fluctuations drawn from a normal distribution of same mean and variance, with compact count
+    // histograms, if the expected background exceeds 1/tolerance^2 (the relative accuracy of the approximation
+    // is of the order of the skewness 1/sqrt(yield)), 0 (default) always drawing Poisson counts
+    inline void setGaussianRegime(const double tolerance) {m_gaussTolerance=tolerance;}
+    inline bool isGaussian() const {return m_gaussTolerance>0 && m_yieldBg*m_gaussTolerance*m_gaussTolerance>=1;}
+
     // generation of yield distribution
     void generateDistrYield(const int nbExp);
+    // the same in steps, for yields generated outside of the channel: creation of the histograms,
+    // filling with the yields of the background samples and of signal of a pseudo-experiment,
+    // then normalisation to nbExp pseudo-experiments
+    void createDistrYield();
+    void fillDistrYield(const double *bkgYields,const double sigYield) const;
+    void normaliseDistrYield(const int nbExp);
     YieldWithUncert getGeneratedYieldBkg() const;
     
     // methods called for observed and expected (median, -+1 sigma, +-2 sigma) limit computation
+    // cls is the CLs at the returned limit (with MethFit, the value of the fit of log(CLs))
     virtual double sigStrengthExclusion(const LimitType type,const int nbExp,double &cls,
 					const double muHint=1,const OTH::MethType method=MethDichotomy);
 
@@ -120,10 +178,18 @@ namespace OTH {
     // combination type for systematics
     inline void setCombinationType(const bool additive) {m_additiveSystComb=additive;}
 
+    // specialised kernel for the generation of samples (not owned, generic code used if null)
+    inline void setToyKernel(const ToyKernel *kernel) {m_pKernel=kernel;}
+    // filling of the histograms of systematics distributions (off by default), done by the generic
+    // code, the specialised kernel being used only when they are not filled
+    inline void setSystDistrFilling(const bool fill) {m_fillSystDistr=fill;}
+    inline bool isSystDistrFilling() const {return m_fillSystDistr;}
+
     // print samples
     void printSamples() const;
     
-    // get histograms of systematics distributions
+    // get histograms of systematics distributions, the filling being enabled (with a warning) for
+    // the following pseudo-experiments if it was off
     TH1 *getSigSystDistr(const std::string &systName) const;
     TH1 *getBkgSystDistr(const std::string &bkgName,const std::string &systName) const;
     
@@ -137,19 +203,36 @@ namespace OTH {
     virtual TH1 *getHistoLLRsb() const;
     virtual TH1 *getHistoLLRb() const;
 
+    // also deletes the histograms of the channel and of its samples
+    virtual void releaseMemory();
+
   private:
     Channel();
     Channel(const Channel&);
     Channel &operator=(const Channel&);
     
+    void releaseHistos();
+    void requestSystDistr() const;
     int generateSinglePseudoExpBg(double &expected) const;
+    int drawCount(const double expected) const;
     double generateSingleSample(const OTH::Sample &sample,const double mu=1) const;
+    void getStatNodes(const Sample &sample,const double mu,std::vector<double> &x,std::vector<double> &w,double &shape) const;
+    // weight of a point of the grid of systematic variations (node index of each systematic uncertainty),
+    // and scale factor of each sample at this point
+    double gridPointScales(const std::vector<const Sample*> &samples,const std::vector< std::vector<unsigned int> > &sampleSysts,
+			   const std::vector<double> &zSyst,const std::vector<double> &wSyst,
+			   const std::vector<unsigned int> &node,std::vector<double> &scales) const;
+    int getCountForLimit(const int type,const std::vector<double> &distrB) const;
+    double sigStrengthExclusionQuadrature(const LimitType type,double &cls,const double mu0);
 
     std::string m_name,m_nameLaTeX; // channel name
     
     Systematics &m_syste; // list of systematic uncertainties
     PdfGenerator &m_statSampling; // implementation of statistical uncertainty variation
+    const ToyKernel *m_pKernel; // specialised implementation of sample generation
+    mutable bool m_fillSystDistr; // histograms of systematics distributions filled
     std::deque<Sample> m_bgSamples; // background samples
+    NameIndex m_bgIndex; // index of background samples from their full names
     Sample m_sigSample; // signal sample
     double m_sigStrength; // signal strength (scale factor of signal)
     int m_yieldData,m_yieldSaved; // number of observed events in data
@@ -158,6 +241,8 @@ namespace OTH {
     double m_yieldBg,m_yieldSB; // expected yields in b or mu*s+b
     mutable double m_cacheLog,m_cacheYieldS; // cache for LLR computation
     mutable bool m_cached; // cache flag
+    int m_nbNodesSyst,m_nbNodesStat; // number of nodes for quadrature
+    double m_gaussTolerance; // accuracy of the normal approximation of Poisson counts
     
     // distributions
     std::vector<TH1*> m_pHs; // main histos
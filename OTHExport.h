@@ -0,0 +1,123 @@
+///////////////////////////////////////////////////////////////////////////////////
+// This file is part the software OpTHyLiC
+// Copyright © 2015 Laboratoire de Physique Corpusculaire de Clermont-Ferrand
+// Developpers: David Calvet, Emmanuel Busato, Timothée Theveneaux-Pelzer
+// Contact: opthylic@in2p3.fr
+//
+//     This program is free software: you can redistribute it and/or modify
+//     it under the terms of the GNU General Public License as published by
+//     the Free Software Foundation, either version 3 of the License, or
+//     (at your option) any later version.
+// 
+//     This program is distributed in the hope that it will be useful,
+//     but WITHOUT ANY WARRANTY; without even the implied warranty of
+//     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//     GNU General Public License for more details.
+// 
+//     You should have received a copy of the GNU General Public License
+//     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef OTH_EXPORT_H
+#define OTH_EXPORT_H
+
+#include <string>
+#include <vector>
+
+class TH1;
+class TGraph;
+
+namespace OTH {
+
+  /// Columnar binary export of results, for fast aggregation of many jobs.
+  // A file starts with a header (magic "OTHX", format version, byte order marker)
+  // followed by blocks appended one after the other. Each block has a 16 bytes header
+  // (magic "OTHB", number of rows and columns, size of the names), the names of the block
+  // and of its columns (each one as its length on 4 bytes then its characters, padded
+  // with zeros to a multiple of 8 bytes), then the values of each column as contiguous
+  // doubles, so that all values are aligned on 8 bytes and a mapped file can be read
+  // without any copy.
+  // Several jobs can append to the same file: it is locked (flock) while open checks the
+  // existing blocks and while each block is written, so that blocks are never interleaved
+  // and a block being written by another job is not taken for a truncated one. On network
+  // file systems without flock support, each job must write its own file.
+  class Export {
+
+  public:
+
+    enum {Version=2};
+
+    Export();
+    // opens the file (see open)
+    Export(const std::string &fileName);
+
+    ~Export();
+
+    // opens the file for appending, it is created if it does not exist
+    // (an existing file must have the same format version, and a truncated last block
+    // left by an interrupted job is removed)
+    void open(const std::string &fileName);
+    void close();
+    inline bool isOpen() const {return m_fd>=0;}
+
+    // appends a block of columns of the same length
+    void write(const std::string &name,const std::vector<std::string> &columnNames,
+	       const std::vector< std::vector<double> > &columns);
+    // appends a histogram, columns x (bin centres), content and error (nothing if null)
+    void write(const std::string &name,const TH1 *pHisto);
+    // appends a graph, columns x and y (nothing if null)
+    void write(const std::string &name,TGraph *pGraph);
+
+  private:
+    Export(const Export&);
+    Export &operator=(const Export&);
+
+    int m_fd; // file descriptor
+  };
+
+  /// Reading of an exported file mapped in memory (read only), the columns being
+  // pointers to the mapped values. A truncated last block (interrupted job) is ignored.
+  class ExportReader {
+
+  public:
+
+    ExportReader(const std::string &fileName);
+
+    ~ExportReader();
+
+    inline unsigned int getVersion() const {return m_version;}
+    inline unsigned int getNbBlocks() const {return m_blocks.size();}
+    const std::string &getName(const unsigned int block) const;
+    unsigned int getNbRows(const unsigned int block) const;
+    unsigned int getNbColumns(const unsigned int block) const;
+    const std::string &getColumnName(const unsigned int block,const unsigned int column) const;
+
+    // values of a column (getNbRows values)
+    const double *getColumn(const unsigned int block,const unsigned int column) const;
+    // values of the column with the given name, 0 if none
+    const double *getColumn(const unsigned int block,const std::string &columnName) const;
+
+    // index of the first block with the given name from block first, -1 if none
+    int findBlock(const std::string &name,const unsigned int first=0) const;
+
+  private:
+    ExportReader(const ExportReader&);
+    ExportReader &operator=(const ExportReader&);
+
+    struct Block {
+      std::string name;
+      unsigned int nbRows;
+      std::vector<std::string> columnNames;
+      const double *pValues;
+    };
+    const Block &getBlock(const unsigned int block) const;
+
+    const char *m_pData; // mapped file
+    size_t m_size;
+    unsigned int m_version;
+    std::vector<Block> m_blocks;
+  };
+
+}
+
+#endif // OTH_EXPORT_H
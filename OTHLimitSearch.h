@@ -0,0 +1,126 @@
+///////////////////////////////////////////////////////////////////////////////////
+// This file is part the software OpTHyLiC
+// Copyright © 2015 Laboratoire de Physique Corpusculaire de Clermont-Ferrand
+// Developpers: David Calvet, Emmanuel Busato, Timothée Theveneaux-Pelzer
+// Contact: opthylic@in2p3.fr
+//
+//     This program is free software: you can redistribute it and/or modify
+//     it under the terms of the GNU General Public License as published by
+//     the Free Software Foundation, either version 3 of the License, or
+//     (at your option) any later version.
+// 
+//     This program is distributed in the hope that it will be useful,
+//     but WITHOUT ANY WARRANTY; without even the implied warranty of
+//     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//     GNU General Public License for more details.
+// 
+//     You should have received a copy of the GNU General Public License
+//     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef OTH_LIMITSEARCH_H
+#define OTH_LIMITSEARCH_H
+
+#include <vector>
+
+#include "OTHTypes.h"
+
+namespace OTH {
+
+  class Base;
+
+  /// Resumable search of the signal strength excluded at a confidence level
+  // (same steps as Algorithms::sigStrengthExclusion): while the search is pending, it
+  // requests the CLs at getMu() with getNbExp() pseudo-experiments, and the answer given
+  // to setCLs computes the next request
+  class LimitSearch {
+
+  public:
+
+    LimitSearch(const double mu0,const double mu0Step,const int nbExp,const int type,
+		const double confLevel,const bool extrapol=false);
+
+    // true while a CLs evaluation is requested
+    inline bool isPending() const {return StepDone!=m_step;}
+
+    // requested evaluation
+    inline double getMu() const {return m_mu;}
+    inline int getNbExp() const {return m_nbExp;}
+    inline int getType() const {return m_type;}
+
+    // answer to the requested evaluation
+    void setCLs(const double cls);
+
+    // excluded signal strength once the search is done (0 if it failed), and last CLs
+    inline double getLimit() const {return m_limit;}
+    inline double getCLs() const {return m_cls;}
+    inline bool hasFailed() const {return m_failed;}
+    inline int getNbEvaluations() const {return m_nbEval;}
+
+  private:
+
+    // scan of the first and second points, then extrapolation or dichotomy, and final evaluation
+    enum Step {StepFirstPoint,StepSecondPoint,StepExtrapolated,StepDichotomy,StepFinal,StepDone};
+    enum Direction {DirNone,DirUp,DirDown};
+
+    void scanPoint(); // next mu of the first and second points scans
+    void nextDichotomy(); // next request of the dichotomy
+    void stop(const double limit,const bool failed);
+
+    int m_nbExp,m_type;
+    bool m_extrapol;
+    double m_targCLs,m_logTargCLs,m_minCLs,m_maxCLs,m_precMu;
+    Step m_step;
+    int m_direction;
+    int m_iter,m_nbEval;
+    double m_mu,m_muPrev,m_muStep,m_muFactor;
+    double m_cls,m_clsPrev;
+    double m_muMin,m_muMax,m_clsMin,m_clsMax,m_logClsMin,m_logClsMax;
+    double m_limit;
+    bool m_failed;
+  };
+
+  /// Interleaved execution of many limit searches: at each round, the pending requests for
+  // the same model, signal strength and number of pseudo-experiments share a single generation
+  // of pseudo-experiments, and the requests of different models are processed concurrently
+  // on several threads if C++11 is available (models are not owned)
+  class LimitScheduler {
+
+  public:
+
+    LimitScheduler();
+
+    ~LimitScheduler();
+
+    // adds a search on the model, returning its index
+    unsigned int add(Base &model,const LimitSearch &search);
+
+    // adds a search with the starting point of OpTHyLiC::sigStrengthExclusion
+    unsigned int add(Base &model,const LimitType type,const int nbExp,const double mu0=0.5,
+		     const double mu0Step=3,const bool extrapol=false);
+
+    // runs the searches until all of them are done, on nbThreads threads (0 for number of cores)
+    void run(int nbThreads=0);
+
+    inline unsigned int getNbSearches() const {return m_searches.size();}
+    inline const LimitSearch &getSearch(const unsigned int i) const {return m_searches[i];}
+
+    // number of generations of pseudo-experiments, and of CLs evaluations they answered
+    inline int getNbPasses() const {return m_nbPasses;}
+    inline int getNbEvaluations() const {return m_nbEvaluations;}
+
+  private:
+    LimitScheduler(const LimitScheduler&);
+    LimitScheduler &operator=(const LimitScheduler&);
+
+    // answers the pending requests of the searches (all on the same model), returning the number of passes
+    int runModel(const std::vector<unsigned int> &searches);
+
+    std::vector<Base*> m_pModels; // model of each search
+    std::vector<LimitSearch> m_searches;
+    int m_nbPasses,m_nbEvaluations;
+  };
+
+}
+
+#endif // OTH_LIMITSEARCH_H
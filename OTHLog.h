@@ -0,0 +1,72 @@
+///////////////////////////////////////////////////////////////////////////////////
+// This file is part the software OpTHyLiC
+// Copyright © 2015 Laboratoire de Physique Corpusculaire de Clermont-Ferrand
+// Developpers: David Calvet, Emmanuel Busato, Timothée Theveneaux-Pelzer
+// Contact: opthylic@in2p3.fr
+//
+//     This program is free software: you can redistribute it and/or modify
+//     it under the terms of the GNU General Public License as published by
+//     the Free Software Foundation, either version 3 of the License, or
+//     (at your option) any later version.
+// 
+//     This program is distributed in the hope that it will be useful,
+//     but WITHOUT ANY WARRANTY; without even the implied warranty of
+//     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//     GNU General Public License for more details.
+// 
+//     You should have received a copy of the GNU General Public License
+//     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef OTH_LOG_H
+#define OTH_LOG_H
+
+#include <ostream>
+#include <sstream>
+
+namespace OTH {
+
+  enum LogLevel {LogQuiet,LogError,LogWarning,LogInfo,LogDebug};
+
+  /// Messages of the library, written if their level is enabled (up to warnings by default).
+  // Errors and warnings are written at once, other messages are kept in a buffer per thread
+  // (with C++11) written to the output stream when it is large, at the end of a limit search,
+  // or when the thread ends,
+  // so that messages of concurrent threads are not interleaved and do not flush each line.
+  // The CLs evaluations of limit searches are kept in OTH::Base::getSearchTrace for the export.
+  class Log {
+
+  public:
+
+    static void setLevel(const LogLevel level);
+    inline static LogLevel getLevel() {return s_level;}
+    inline static bool isEnabled(const LogLevel level) {return level!=LogQuiet && level<=s_level;}
+
+    // stream where messages are written (standard output by default)
+    static void setStream(std::ostream &out);
+
+    // buffer of the current thread, a message of the given level ends with endMessage
+    static std::ostringstream &buffer();
+    static void endMessage(const LogLevel level);
+
+    // writes the messages of the current thread
+    static void flush();
+
+  private:
+    Log();
+
+    static LogLevel s_level;
+  };
+
+}
+
+// message of the given level, e.g. OTH_LOG(OTH::LogInfo,"mu=" << mu)
+#define OTH_LOG(level,message)						\
+  do {									\
+    if (OTH::Log::isEnabled(level)) {					\
+      OTH::Log::buffer() << message;					\
+      OTH::Log::endMessage(level);					\
+    }									\
+  } while (0)
+
+#endif // OTH_LOG_H
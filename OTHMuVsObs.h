@@ -21,6 +21,8 @@
 #ifndef OTH_MUVSOBS_H
 #define OTH_MUVSOBS_H
 
+#include <iostream>
+
 namespace OTH {
 
   class MuVsObs {
@@ -39,6 +41,10 @@ namespace OTH {
     void reset();
 
     double interpolateMu(const int obs) const;
+
+    // text serialization, full precision
+    void write(std::ostream &out) const;
+    bool read(std::istream &in);
     
   private:
 
@@ -22,6 +22,7 @@
 #define OTH_OBSERVED_H
 
 #include <vector>
+#include <iostream>
 
 namespace OTH {
 
@@ -39,11 +40,18 @@ namespace OTH {
 
     inline void resize(const unsigned int size) {m_events.resize(size,0);}
     inline void set(const unsigned int i,const int obs) {m_events[i]=obs;}
+    inline int get(const unsigned int i) const {return m_events[i];}
+    inline unsigned int size() const {return m_events.size();}
 
     bool operator==(const Observed &obs) const;
     bool operator<(const Observed &obs) const;
 
     void print() const;
+    void print(std::ostream &out) const;
+
+    // text serialization (numbers of events separated by spaces, size is not written)
+    void write(std::ostream &out) const;
+    bool read(std::istream &in);
     
   private:
     Observed &operator=(const Observed&);
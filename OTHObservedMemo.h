@@ -0,0 +1,102 @@
+///////////////////////////////////////////////////////////////////////////////////
+// This file is part the software OpTHyLiC
+// Copyright © 2015 Laboratoire de Physique Corpusculaire de Clermont-Ferrand
+// Developpers: David Calvet, Emmanuel Busato, Timothée Theveneaux-Pelzer
+// Contact: opthylic@in2p3.fr
+//
+//     This program is free software: you can redistribute it and/or modify
+//     it under the terms of the GNU General Public License as published by
+//     the Free Software Foundation, either version 3 of the License, or
+//     (at your option) any later version.
+// 
+//     This program is distributed in the hope that it will be useful,
+//     but WITHOUT ANY WARRANTY; without even the implied warranty of
+//     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//     GNU General Public License for more details.
+// 
+//     You should have received a copy of the GNU General Public License
+//     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef OTH_OBSERVEDMEMO_H
+#define OTH_OBSERVEDMEMO_H
+
+#include <vector>
+#include <iostream>
+
+#include "OTHMuVsObs.h"
+
+namespace OTH {
+
+  class Observed;
+
+  /// Memo of the signal strengths computed for observations in all channels,
+  // and of the tables used to interpolate them channel by channel.
+  // Observations are interned in a single pool of events and found with open addressing
+  // on a hash which is updated in O(1) when a single channel changes, so that updating
+  // or using the interpolation tables of all channels is O(C) for C channels.
+  class ObservedMemo {
+
+  public:
+
+    ObservedMemo();
+
+    ~ObservedMemo();
+
+    // removes everything, for observations in nbChannels channels
+    void reset(const unsigned int nbChannels);
+
+    inline unsigned int getNbChannels() const {return m_nbChannels;}
+    inline unsigned int size() const {return m_mus.size();}
+
+    // memorised mu for the observation, returns false if unknown
+    bool find(const Observed &obs,double &mu) const;
+    // memorise mu for the observation (replaces the previous value if any)
+    void setMu(const Observed &obs,const double mu);
+
+    // observation and mu of the i-th memorised observation (in order of insertion)
+    void get(const unsigned int i,Observed &obs,double &mu) const;
+
+    // adds mu to the interpolation tables of the observed events in each channel, others being fixed
+    void addInterpolation(const Observed &obs,const double mu);
+    // first interpolated mu found for the observation, 0 if none
+    double interpolateMu(const Observed &obs) const;
+
+    // text serialization of interpolation tables (memorised mus are written with get)
+    void writeInterpolation(std::ostream &out) const;
+    bool readInterpolation(std::istream &in);
+    // interpolation tables written per channel with observations (first checkpoint version)
+    bool readInterpolationPerChannel(std::istream &in);
+
+  private:
+    ObservedMemo(const ObservedMemo&);
+    ObservedMemo &operator=(const ObservedMemo&);
+
+    unsigned long long hashEvents(const Observed &obs) const;
+    unsigned long long hashChannel(const unsigned int c,const int events) const;
+    int findSlot(const std::vector<unsigned long long> &keys,const std::vector<int> &indices,
+		 const unsigned long long key,const Observed *pObs) const;
+    void insertSlot(std::vector<unsigned long long> &keys,std::vector<int> &indices,
+		    const unsigned long long key,const int index,const Observed *pObs);
+    void rehash(std::vector<unsigned long long> &keys,std::vector<int> &indices,const unsigned int nbEntries);
+    MuVsObs &getInterpolation(const unsigned long long key);
+
+    unsigned int m_nbChannels;
+
+    // memorised mus
+    std::vector<int> m_events; // pool of interned observations, m_nbChannels numbers of events each
+    std::vector<double> m_mus; // mus of interned observations
+    std::vector<unsigned long long> m_muKeys; // open addressing table: hashes
+    std::vector<int> m_muIndices; // open addressing table: indices of observations (-1 if free)
+
+    // interpolation tables, from the hash of the observation with the events of one channel masked
+    // (only used as a starting point, so that keys are not checked further)
+    std::vector<MuVsObs> m_interpol;
+    std::vector<unsigned long long> m_interpolKeys;
+    std::vector<unsigned long long> m_interpolTableKeys;
+    std::vector<int> m_interpolIndices;
+  };
+
+}
+
+#endif // OTH_OBSERVEDMEMO_H
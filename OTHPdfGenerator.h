@@ -44,9 +44,19 @@ namespace OTH {
     double drawGamma(const double mean, const double sigma, const float shapeParameterShift);
     
     int poisson(const double expected);
+    // normal approximation of poisson, with the same mean and variance (rounded to the nearest count)
+    int poissonGaussian(const double expected);
+    // smallest count whose cumulative poisson probability is at least u (inversion of a uniform draw)
+    static int poissonQuantile(const double expected,const double u);
+
+    double uniform();
+
+    inline StatType getStatType() const {return m_statType;}
+    inline RdmGenerator *getRdmGenerator() const {return m_pRdmGen;}
 
   protected:
     RdmGenerator* m_pRdmGen;
+    StatType m_statType;
 
   private:
     PdfGenerator();
@@ -0,0 +1,54 @@
+///////////////////////////////////////////////////////////////////////////////////
+// This file is part the software OpTHyLiC
+// Copyright © 2015 Laboratoire de Physique Corpusculaire de Clermont-Ferrand
+// Developpers: David Calvet, Emmanuel Busato, Timothée Theveneaux-Pelzer
+// Contact: opthylic@in2p3.fr
+//
+//     This program is free software: you can redistribute it and/or modify
+//     it under the terms of the GNU General Public License as published by
+//     the Free Software Foundation, either version 3 of the License, or
+//     (at your option) any later version.
+// 
+//     This program is distributed in the hope that it will be useful,
+//     but WITHOUT ANY WARRANTY; without even the implied warranty of
+//     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//     GNU General Public License for more details.
+// 
+//     You should have received a copy of the GNU General Public License
+//     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef OTH_PRECISIONREPORT_H
+#define OTH_PRECISIONREPORT_H
+
+#include <iostream>
+
+namespace OTH {
+
+  /// Accuracy of the mixed precision generation of samples compared with the double precision
+  // one for a model (see OpTHyLiC::validateMixedPrecision)
+  struct PrecisionReport {
+
+    PrecisionReport();
+
+    void print(std::ostream &out=std::cout) const;
+
+    int nbExp; // pseudo-experiments of each comparison
+    double mu; // signal strength
+
+    // sample yields generated with the same variations and statistical draws
+    long nbSamples;
+    double maxSampleRelDiff,meanSampleRelDiff;
+    double maxChannelRelDiff; // expected s+b yield of channels
+
+    // pseudo-experiments with common random numbers
+    double fracToysChanged; // fraction of pseudo-experiments with a different LLR (b only or s+b)
+    double maxLLRDiff;
+    double clsDouble,clsMixed; // CLs for the observed events in data
+    double clsRelError; // relative statistical uncertainty of CLs with nbExp pseudo-experiments
+    double secondsDouble,secondsMixed; // generation of the pseudo-experiments
+  };
+
+}
+
+#endif // OTH_PRECISIONREPORT_H
@@ -0,0 +1,53 @@
+///////////////////////////////////////////////////////////////////////////////////
+// This file is part the software OpTHyLiC
+// Copyright © 2015 Laboratoire de Physique Corpusculaire de Clermont-Ferrand
+// Developpers: David Calvet, Emmanuel Busato, Timothée Theveneaux-Pelzer
+// Contact: opthylic@in2p3.fr
+//
+//     This program is free software: you can redistribute it and/or modify
+//     it under the terms of the GNU General Public License as published by
+//     the Free Software Foundation, either version 3 of the License, or
+//     (at your option) any later version.
+// 
+//     This program is distributed in the hope that it will be useful,
+//     but WITHOUT ANY WARRANTY; without even the implied warranty of
+//     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//     GNU General Public License for more details.
+// 
+//     You should have received a copy of the GNU General Public License
+//     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef OTH_QUADRATURE_H
+#define OTH_QUADRATURE_H
+
+#include <vector>
+
+namespace OTH {
+
+  /// Gaussian quadrature rules, normalised to compute expectation values
+  // E[f(X)] is approximated by sum_i w[i]*f(x[i]), with sum_i w[i]=1
+  class Quadrature {
+
+  public:
+
+    Quadrature();
+    
+    ~Quadrature();
+
+    // X following a standard normal distribution (Gauss-Hermite)
+    static void normal(const int n,std::vector<double> &x,std::vector<double> &w);
+
+    // X following a uniform distribution in [a,b] (Gauss-Legendre)
+    static void uniform(const int n,const double a,const double b,std::vector<double> &x,std::vector<double> &w);
+
+    // X following a standard normal distribution truncated to [edges.front(),edges.back()],
+    // with n Gauss-Legendre nodes between consecutive edges (for functions which are only
+    // piecewise smooth, e.g. the interpolations of systematic uncertainties)
+    static void normalPiecewise(const int n,const std::vector<double> &edges,std::vector<double> &x,std::vector<double> &w);
+
+  };
+
+}
+
+#endif // OTH_QUADRATURE_H
@@ -21,6 +21,8 @@
 #ifndef OTH_RDMGENERATOR_H
 #define OTH_RDMGENERATOR_H
 
+#include <iostream>
+#include <string>
 #if defined CPP11
 #include <random>
 #endif
@@ -40,6 +42,15 @@ namespace OTH {
     virtual double logNormal(const double mean, const double sigma)=0; // lognormal distribution
     virtual double gamma(const double mean, const double sigma, const float shapeParameterShift)=0; // gamma distribution
     virtual double uniform()=0; // uniform distribution
+    // save and restore the full engine state, so that a sequence can be continued exactly
+    virtual void writeState(std::ostream &out) const =0;
+    virtual bool readState(std::istream &in)=0;
+    // restart the sequence from a new seed (not 0), the initial seed being kept
+    virtual void setSeed(const unsigned int seed)=0;
+    // generator with the given engine type (see OTHTypes.h), 0 if the type is unknown
+    static RdmGenerator *create(const int engineType,const int seed=0);
+    // name of the class implementing the given engine type
+    static std::string getEngineName(const int engineType);
   protected:
     int m_seed;//the original seed is kept
   };
@@ -54,6 +65,9 @@ namespace OTH {
     double logNormal(const double mean, const double sigma); // lognormal distribution
     double gamma(const double mean, const double sigma, const float shapeParameterShift); // gamma distribution
     double uniform(); // uniform distribution
+    void writeState(std::ostream &out) const;
+    bool readState(std::istream &in);
+    void setSeed(const unsigned int seed);
   private:
     TRandom3 m_rdm;
   };
@@ -69,6 +83,9 @@ namespace OTH {
     double logNormal(const double mean, const double sigma); // lognormal distribution
     double gamma(const double mean, const double sigma, const float shapeParameterShift); // gamma distribution
     double uniform(); // uniform distribution
+    void writeState(std::ostream &out) const;
+    bool readState(std::istream &in);
+    void setSeed(const unsigned int seed);
   private:
     // pseudo-random number engine
     T m_engine;
@@ -0,0 +1,63 @@
+///////////////////////////////////////////////////////////////////////////////////
+// This file is part the software OpTHyLiC
+// Copyright © 2015 Laboratoire de Physique Corpusculaire de Clermont-Ferrand
+// Developpers: David Calvet, Emmanuel Busato, Timothée Theveneaux-Pelzer
+// Contact: opthylic@in2p3.fr
+//
+//     This program is free software: you can redistribute it and/or modify
+//     it under the terms of the GNU General Public License as published by
+//     the Free Software Foundation, either version 3 of the License, or
+//     (at your option) any later version.
+// 
+//     This program is distributed in the hope that it will be useful,
+//     but WITHOUT ANY WARRANTY; without even the implied warranty of
+//     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//     GNU General Public License for more details.
+// 
+//     You should have received a copy of the GNU General Public License
+//     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef OTH_RUNPLAN_H
+#define OTH_RUNPLAN_H
+
+#include <iostream>
+
+namespace OTH {
+
+  /// Predicted cost of limit computations for a model, from a calibration run
+  // with few pseudo-experiments (see OpTHyLiC::planRun)
+  struct RunPlan {
+
+    RunPlan();
+
+    void print(std::ostream &out=std::cout) const;
+
+    // calibration: limit search with nbExpPilot pseudo-experiments per CLs evaluation
+    int nbExpPilot;
+    double pilotSeconds; // real time of the calibration
+    double toysPerSecond; // pseudo-experiments generated per second for this model
+    double secondsPerEvaluation; // time of a CLs evaluation besides the pseudo-experiments
+    double muPilot; // limit found by the calibration
+    double clsb,clb; // CLs+b and CLb at this limit
+    int evaluationsPerSearch; // CLs evaluations of the calibration search
+
+    // single limit with nbExp pseudo-experiments per CLs evaluation
+    int nbExp;
+    double secondsPerLimit;
+    double clsRelError; // relative statistical uncertainty of CLs at the limit
+    double clsPrecision; // target relative uncertainty of CLs (0 if none)
+    long nbExpForPrecision; // pseudo-experiments per evaluation needed for this target
+
+    // expected limits with nbMu background only pseudo-data
+    int nbMu;
+    int nbLimits; // limits to compute (distinct observations not already memorised)
+    double memoHitRate; // fraction of pseudo-data whose limit is memorised
+    double secondsExpected;
+
+    double memoryBytes; // distributions, memorised limits and recorded pseudo-experiments
+  };
+
+}
+
+#endif // OTH_RUNPLAN_H
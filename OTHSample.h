@@ -22,9 +22,11 @@
 #define OTH_SAMPLE_H
 
 #include <deque>
+#include <vector>
 
 #include "OTHYieldWithUncert.h"
 #include "OTHSingleSyst.h"
+#include "OTHTypes.h"
 
 class TH1;
 
@@ -41,6 +43,15 @@ namespace OTH {
     void addSyst(const std::string &name,const unsigned int id,
 		 const double low,const double high);
 
+    // removal of the systematic uncertainties whose largest effect on the yield is below threshold
+    // times the total uncertainty of the sample (statistical and systematic in quadrature),
+    // returns the relative decrease of this total uncertainty, the removed ones being appended to pruned
+    double pruneSysts(const double threshold,std::deque<SingleSyst> &pruned);
+    // new indices in OTH::Systematics of the systematic uncertainties (indexed by the current ones)
+    void reindexSysts(const std::vector<unsigned int> &newIds);
+    // statistical and systematic uncertainties in quadrature (absolute, the systematic one being symmetrised)
+    double getTotalUncert() const;
+
     inline void setNameLaTeX(const std::string name) {m_nameLaTeX=name;}
     
     inline std::string getName() const {return m_name;}
@@ -60,6 +71,18 @@ namespace OTH {
     std::string getLaTeXTotalSyst(const int precision) const;
 
     inline void fillSystDistr(const unsigned int i,const double value) const {m_systs[i].fillDistr(value);}
+
+    /// Systematics packed for the kernels of OTH::ToyKernel, with the coefficients depending only on
+    // the systematic, built at their first use and emptied whenever the systematics change
+    struct SystPack {
+      SystPack();
+      int systType; // interpolation style of the coefficients (-1 if not packed)
+      unsigned int nbPadded; // number of systematics rounded up to the width of the kernels
+      std::vector<unsigned int> ids; // indices in OTH::Systematics (0 for the padding)
+      std::vector<float> coefs; // single precision: one array of nbPadded values per coefficient
+      std::vector<double> coefsDouble; // double precision: the coefficients of each systematic in turn
+    };
+    inline SystPack &getSystPack() const {return m_systPack;}
     
     TH1 *getSystDistr(const std::string &systName) const;
     void print() const;
@@ -68,6 +91,8 @@ namespace OTH {
     void fillYieldHisto(const double yield) const;
     TH1 *getYieldHisto() const {return m_pHyield;}
     YieldWithUncert getGeneratedYield() const;
+    // deletes the yield histogram and the distributions of the systematic uncertainties
+    void releaseHistos();
     
   private:
     static std::string getLaTeXSyst(const double low,const double high,const int precision);
@@ -76,7 +101,10 @@ namespace OTH {
     YieldWithUncert m_yield;
     double m_systLow,m_systHigh;
     std::deque<SingleSyst> m_systs;
+    NameIndex m_systIndex; // index of systematics from their names
+    IdIndex m_systIdIndex; // index of systematics from their ids in OTH::Systematics
     TH1 *m_pHyield;
+    mutable SystPack m_systPack; // packed systematics for the kernels
   };
 
 }
@@ -23,6 +23,7 @@
 
 #include <iostream>
 #include <deque>
+#include <vector>
 
 #include "OTHShapeSyst.h"
 #include "OTHSingleSyst.h"
@@ -53,6 +54,15 @@ namespace OTH {
 
     void print(const bool printStatUncert=true) const;
     void writeInputFile(std::ostream &out,const int iBin) const;
+    // input for the sum of several bins, shape systematics being fully correlated between bins
+    void writeInputFile(std::ostream &out,const std::vector<int> &bins) const;
+    double getContent(const std::vector<int> &bins) const;
+
+    // groups of bins to be written as channels: the bins of lowest s/b (with non-zero signal and background)
+    // are merged, or dropped, within a maximal relative loss of the expected sensitivity, estimated as the sum
+    // over bins of the Asimov significance squared without systematics (z2 and z2Pruned, before and after)
+    static void groupBins(const Shape &signal,const std::deque<Shape*> &backgrounds,const double maxLoss,
+			  std::vector< std::vector<int> > &groups,double &z2,double &z2Pruned);
 
   private:
     Shape();
@@ -44,9 +44,12 @@ namespace OTH {
 
     void createDistr(const std::string &smplName);
     void fillDistr(const double value) const;
+    // deletes the distribution, which is no longer filled
+    void releaseDistr();
     
     inline std::string getName() const {return m_name;}
     inline unsigned int getId() const {return m_id;}
+    inline void setId(const unsigned int id) {m_id=id;}
     inline double getLow() const {return m_low;}
     inline double getHigh() const {return m_high;}
     
@@ -0,0 +1,59 @@
+///////////////////////////////////////////////////////////////////////////////////
+// This file is part the software OpTHyLiC
+// Copyright © 2015 Laboratoire de Physique Corpusculaire de Clermont-Ferrand
+// Developpers: David Calvet, Emmanuel Busato, Timothée Theveneaux-Pelzer
+// Contact: opthylic@in2p3.fr
+//
+//     This program is free software: you can redistribute it and/or modify
+//     it under the terms of the GNU General Public License as published by
+//     the Free Software Foundation, either version 3 of the License, or
+//     (at your option) any later version.
+// 
+//     This program is distributed in the hope that it will be useful,
+//     but WITHOUT ANY WARRANTY; without even the implied warranty of
+//     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//     GNU General Public License for more details.
+// 
+//     You should have received a copy of the GNU General Public License
+//     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef OTH_STREAMQUANTILE_H
+#define OTH_STREAMQUANTILE_H
+
+namespace OTH {
+
+  /// Streaming estimation of a quantile with the P-square algorithm
+  // (R. Jain and I. Chlamtac, Communications of the ACM 28 (1985) 1076),
+  // using five markers only, whatever the number and range of values
+  class StreamQuantile {
+
+  public:
+
+    StreamQuantile(const double p=0.5);
+
+    ~StreamQuantile();
+
+    void add(const double x);
+    void reset();
+
+    // estimated quantile (exact up to five values, 0 if empty)
+    double get() const;
+    inline long getCount() const {return m_count;}
+    inline double getProbability() const {return m_p;}
+
+  private:
+    double parabolic(const int i,const double d) const;
+    double linear(const int i,const int d) const;
+
+    double m_p; // probability of the quantile
+    long m_count; // number of values
+    double m_heights[5]; // marker heights
+    double m_positions[5]; // actual marker positions
+    double m_desired[5]; // desired marker positions
+    double m_increments[5]; // increments of desired positions
+  };
+
+}
+
+#endif // OTH_STREAMQUANTILE_H
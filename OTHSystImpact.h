@@ -0,0 +1,54 @@
+///////////////////////////////////////////////////////////////////////////////////
+// This file is part the software OpTHyLiC
+// Copyright © 2015 Laboratoire de Physique Corpusculaire de Clermont-Ferrand
+// Developpers: David Calvet, Emmanuel Busato, Timothée Theveneaux-Pelzer
+// Contact: opthylic@in2p3.fr
+//
+//     This program is free software: you can redistribute it and/or modify
+//     it under the terms of the GNU General Public License as published by
+//     the Free Software Foundation, either version 3 of the License, or
+//     (at your option) any later version.
+// 
+//     This program is distributed in the hope that it will be useful,
+//     but WITHOUT ANY WARRANTY; without even the implied warranty of
+//     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//     GNU General Public License for more details.
+// 
+//     You should have received a copy of the GNU General Public License
+//     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef OTH_SYSTIMPACT_H
+#define OTH_SYSTIMPACT_H
+
+#include <string>
+#include <vector>
+#include <iostream>
+
+namespace OTH {
+
+  /// Impact of a systematic uncertainty on the expected (median) and observed limits
+  // (see OpTHyLiC::computeSystImpacts), all limits of a ranking being computed
+  // from the same pseudo-experiments
+  struct SystImpact {
+
+    SystImpact();
+
+    // shift of the limits when the uncertainty is removed
+    inline double getExpImpact() const {return expNominal-expRemoved;}
+    inline double getObsImpact() const {return obsNominal-obsRemoved;}
+
+    // impacts ranked by decreasing shift of the expected limit
+    static void print(const std::vector<SystImpact> &impacts,std::ostream &out=std::cout);
+
+    std::string name;
+    unsigned int index; // index in OTH::Systematics
+    double expNominal,expRemoved; // expected limit with all uncertainties, and without this one
+    double expUp,expDown; // expected limit with this uncertainty fixed at +1 or -1 sigma
+    double obsNominal,obsRemoved;
+    double obsUp,obsDown;
+  };
+
+}
+
+#endif // OTH_SYSTIMPACT_H
@@ -22,8 +22,10 @@
 #define OTH_SYSTEMATICS_H
 
 #include <string>
+#include <vector>
 #include <deque>
-#include <map>
+#include <utility>
+#include <cmath>
 
 class TH1;
 
@@ -41,7 +43,24 @@ namespace OTH {
     virtual ~Systematics();
 
     unsigned int add(const std::string &name);
+    // removal of the systematic uncertainties which are not used (flags indexed as returned by add()),
+    // newIds giving the new index of each kept one, returns the number of removed ones
+    unsigned int removeUnused(const std::vector<bool> &used,std::vector<unsigned int> &newIds);
     virtual void variate();
+
+    // antithetic variations: every other call of variate negates the previous variations
+    // (calling it again restarts the pairs)
+    inline void setAntithetic(const bool antithetic) {m_antithetic=antithetic; m_mirrorNext=false;}
+    inline bool isAntithetic() const {return m_antithetic;}
+
+    // variation of a systematic uncertainty fixed to the given value (in sigmas, 0 removes it),
+    // the random numbers used being the same as without fixed variations
+    void fixVariation(const unsigned int index,const double variation);
+    void releaseVariations();
+
+    // variations set to the stored ones of a pseudo-experiment, the ones of systematic uncertainties
+    // added since then being drawn and appended to the stored ones
+    void setVariations(std::vector<double> &variations);
     
     double getScaleFactor(const unsigned int index,
 			  const double low,const double high) const;
@@ -55,16 +74,32 @@ namespace OTH {
     double getScaleFactorPolyExpo(const unsigned int index,
 				  const double low,const double high) const;
 
+    // scale factors for a given variation (in sigmas), without any indirection
+    static double scaleFactorMCLimit(const double var,const double low,const double high);
+    static double scaleFactorLinear(const double var,const double low,const double high);
+    static double scaleFactorExpo(const double var,const double low,const double high);
+    static double scaleFactorPolyExpo(const double var,const double low,const double high);
+    static double scaleFactorAt(const SystType type,const double var,const double low,const double high);
+    // coefficients a to f of the polynomial interpolation of scaleFactorPolyExpo (|var|<1), and the
+    // polynomial itself, so that the coefficients can be computed once per systematic uncertainty
+    static void polyExpoCoefs(const double low,const double high,double *coefs);
+    static double polyExpo(const double var,const double *coefs);
+
     double getVariation(const std::string &name) const;
     double getVariation(const unsigned int index) const;
 
     inline unsigned int getSize() const {return m_names.size();}
+    inline SystType getSystType() const {return m_systType;}
+    // contiguous array of the current variations, indexed as returned by add()
+    inline const double *getVariations() const {return m_variations.empty()?0:&m_variations[0];}
     std::string getName(const unsigned int index) const;
     TH1 *getDistr() const {return m_pH;}
+    // deletes the distribution of the variations, which is no longer filled
+    void releaseDistr();
     void print() const;
     
   protected:
-    std::deque<double> m_variations;
+    std::vector<double> m_variations;
     RdmGenerator* m_pRdmGen;
     TH1 *m_pH;
 
@@ -72,15 +107,112 @@ namespace OTH {
     Systematics();
     Systematics(const Systematics&);
     Systematics &operator=(const Systematics&);
+    void applyFixedVariations();
 
     std::deque<std::string> m_names;
-    std::map<std::string,unsigned int> m_table;
+    NameIndex m_table;
+    SystType m_systType;
+    bool m_antithetic; // antithetic pairs of variations
+    bool m_mirrorNext; // next variations are the opposite of the current ones
+    std::vector< std::pair<unsigned int,double> > m_fixed; // fixed variations
     
     // this pointer-to-function will point to one of the getScaleFactorXXX functions above
     double (Systematics::*m_pSF) (const unsigned int index,
 				  const double low,const double high) const;
   };
 
+
+  inline double Systematics::scaleFactorMCLimit(const double var,const double low,const double high)
+  {
+    double sig=-low;
+    if (var>0) sig=high;
+    const double quadMatch=var*(high-low)/2 + var*var*(high+low)/2;
+    const double rf=1/(1+3*std::fabs(var));
+    const double bridge=var*sig*(1-rf) + rf*quadMatch;
+    double lnB=0;
+    if (bridge<0) lnB=std::exp(bridge);
+    else lnB=bridge+1;
+    return lnB;
+  }
+
+  inline double Systematics::scaleFactorLinear(const double var,const double low,const double high)
+  {
+    double sf=1+var*high;
+    if(var<0) sf=1-var*low;
+    if(sf<0) sf=0;
+    return sf;
+  }
+
+  inline double Systematics::scaleFactorExpo(const double var,const double low,const double high)
+  {
+    double sf=0;
+    if((var>=0 && high>-1)||(var<0 && low>-1)) { // exponential interp/extrap
+      double sig=high+1;
+      double absVar=var;
+      if(var<0) {
+	sig=low+1;
+	absVar*=-1;
+      }
+      sf=std::pow(sig,absVar);
+    }
+    else { // linear
+      sf=scaleFactorLinear(var,low,high);
+    }
+    return sf;
+  }
+
+  inline void Systematics::polyExpoCoefs(const double low,const double high,double *coefs)
+  {
+    double pow_up       = 1+high;
+    double pow_down     = 1+low;
+    double pow_up_log   = (1+high) <= 0. ? 0. : pow_up*std::log(1+high);
+    double pow_down_log = (1+low) <= 0. ? 0. : -pow_down*std::log(1+low);
+    double pow_up_log2  = (1+high) <= 0. ? 0. : pow_up_log*std::log(1+high);
+    double pow_down_log2= (1+low) <= 0. ? 0. : pow_down_log*std::log(1+low);
+
+    double S0 = (pow_up+pow_down)/2;
+    double A0 = (pow_up-pow_down)/2;
+    double S1 = (pow_up_log+pow_down_log)/2;
+    double A1 = (pow_up_log-pow_down_log)/2;
+    double S2 = (pow_up_log2+pow_down_log2)/2;
+    double A2 = (pow_up_log2-pow_down_log2)/2;
+    coefs[0] = 1/8.*(      15*A0 -  7*S1 + A2);
+    coefs[1] = 1/8.*(-24 + 24*S0 -  9*A1 + S2);
+    coefs[2] = 1/4.*(    -  5*A0 +  5*S1 - A2);
+    coefs[3] = 1/4.*( 12 - 12*S0 +  7*A1 - S2);
+    coefs[4] = 1/8.*(    +  3*A0 -  3*S1 + A2);
+    coefs[5] = 1/8.*( -8 +  8*S0 -  5*A1 + S2);
+  }
+
+  inline double Systematics::polyExpo(const double var,const double *coefs)
+  {
+    double var2 = var*var ;
+    double var3 = var2*var ;
+    return 1 + coefs[0]*var + coefs[1]*var2 + coefs[2]*var3 + coefs[3]*var2*var2 + coefs[4]*var3*var2 + coefs[5]*var3*var3;
+  }
+
+  inline double Systematics::scaleFactorPolyExpo(const double var,const double low,const double high)
+  {
+    double sf=0;
+    if(var>-1&&var<1) { // polynomial interpolation
+      double coefs[6];
+      polyExpoCoefs(low,high,coefs);
+      sf=polyExpo(var,coefs);
+    }
+    else { // exponential extrapolation
+      sf=scaleFactorExpo(var,low,high);
+    }
+    return sf;
+  }
+
+  inline double Systematics::scaleFactorAt(const SystType type,const double var,const double low,const double high)
+  {
+    if (SystMclimit==type) return scaleFactorMCLimit(var,low,high);
+    else if (SystLinear==type) return scaleFactorLinear(var,low,high);
+    else if (SystExpo==type) return scaleFactorExpo(var,low,high);
+    return scaleFactorPolyExpo(var,low,high);
+  }
+
 }
 
 #endif // OTH_SYSTEMATICS_H
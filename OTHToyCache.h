@@ -0,0 +1,83 @@
+///////////////////////////////////////////////////////////////////////////////////
+// This file is part the software OpTHyLiC
+// Copyright © 2015 Laboratoire de Physique Corpusculaire de Clermont-Ferrand
+// Developpers: David Calvet, Emmanuel Busato, Timothée Theveneaux-Pelzer
+// Contact: opthylic@in2p3.fr
+//
+//     This program is free software: you can redistribute it and/or modify
+//     it under the terms of the GNU General Public License as published by
+//     the Free Software Foundation, either version 3 of the License, or
+//     (at your option) any later version.
+// 
+//     This program is distributed in the hope that it will be useful,
+//     but WITHOUT ANY WARRANTY; without even the implied warranty of
+//     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//     GNU General Public License for more details.
+// 
+//     You should have received a copy of the GNU General Public License
+//     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef OTH_TOYCACHE_H
+#define OTH_TOYCACHE_H
+
+#include <vector>
+#include <deque>
+
+namespace OTH {
+
+  class Channel;
+
+  /// Draws of pseudo-experiments which do not depend on the signal strength, kept to combine
+  // channels incrementally: variations of the systematic uncertainties of each pseudo-experiment,
+  // and for each channel its expected signal (for a signal strength of 1), its background only count,
+  // the background part of its s+b count and the uniform draw giving the signal part of this count.
+  // Draws of channels added later are generated with the stored variations (common random numbers).
+  class ToyCache {
+
+  public:
+
+    struct Draws {
+      const Channel *pChannel;
+      std::vector<double> expectedSig;
+      std::vector<int> countB,countBSB;
+      std::vector<double> uniform;
+    };
+
+    ToyCache();
+
+    ~ToyCache();
+
+    // removes everything, for nbExp pseudo-experiments
+    void reset(const int nbExp=0);
+
+    inline int getNbExp() const {return m_nbExp;}
+    inline unsigned int getNbChannels() const {return m_draws.size();}
+
+    // number of first channels whose draws are stored, the draws of the following ones being removed
+    unsigned int match(const std::deque<Channel*> &channels);
+
+    // stored variations of the systematic uncertainties of pseudo-experiment i
+    inline std::vector<double> &getVariations(const int i) {return m_variations[i];}
+
+    // draws of a new channel, to be filled for all pseudo-experiments
+    Draws &addChannel(const Channel *pChannel);
+    inline const Draws &getDraws(const unsigned int c) const {return m_draws[c];}
+
+    void swap(ToyCache &cache);
+
+    // size of the stored draws, in bytes
+    double getMemorySize() const;
+
+  private:
+    ToyCache(const ToyCache&);
+    ToyCache &operator=(const ToyCache&);
+
+    int m_nbExp; // number of pseudo-experiments
+    std::vector< std::vector<double> > m_variations; // variations of each pseudo-experiment
+    std::deque<Draws> m_draws; // draws of each channel
+  };
+
+}
+
+#endif // OTH_TOYCACHE_H
@@ -0,0 +1,62 @@
+///////////////////////////////////////////////////////////////////////////////////
+// This file is part the software OpTHyLiC
+// Copyright © 2015 Laboratoire de Physique Corpusculaire de Clermont-Ferrand
+// Developpers: David Calvet, Emmanuel Busato, Timothée Theveneaux-Pelzer
+// Contact: opthylic@in2p3.fr
+//
+//     This program is free software: you can redistribute it and/or modify
+//     it under the terms of the GNU General Public License as published by
+//     the Free Software Foundation, either version 3 of the License, or
+//     (at your option) any later version.
+// 
+//     This program is distributed in the hope that it will be useful,
+//     but WITHOUT ANY WARRANTY; without even the implied warranty of
+//     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//     GNU General Public License for more details.
+// 
+//     You should have received a copy of the GNU General Public License
+//     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef OTH_TOYKERNEL_H
+#define OTH_TOYKERNEL_H
+
+#include "OTHTypes.h"
+
+namespace OTH {
+
+  class Sample;
+  class PdfGenerator;
+
+  /// Generation of the expected yield of a single sample for one pseudo-experiment
+  // One implementation is instantiated at compile time for each combination of
+  // systematics interpolation style, statistical sampling and combination type,
+  // so that no indirection is left inside the loop on systematics.
+  class ToyKernel {
+
+  public:
+
+    virtual ~ToyKernel();
+
+    // expected yield of sample scaled by mu, with statistical uncertainty drawn
+    // and systematics applied for the given variations (indexed as in OTH::Systematics)
+    virtual double generateSample(const Sample &sample,const double mu,
+				  const double *variations,PdfGenerator &statSampling) const =0;
+
+    // selects the implementation once for the whole life of the caller
+    // with PrecMixed, the scale factors of the systematics are computed in single precision and
+    // vectorised over the systematics of the sample (the statistical draws are unchanged)
+    static ToyKernel *create(const SystType systType,const StatType statType,const bool additive,
+			     const PrecType precision=PrecDouble);
+
+  protected:
+    ToyKernel();
+
+  private:
+    ToyKernel(const ToyKernel&);
+    ToyKernel &operator=(const ToyKernel&);
+  };
+
+}
+
+#endif // OTH_TOYKERNEL_H
@@ -21,6 +21,13 @@
 #ifndef OTH_TYPES_H
 #define OTH_TYPES_H
 
+#include <string>
+#if defined CPP11
+#include <unordered_map>
+#else
+#include <map>
+#endif
+
 namespace OTH {
 
   // Type of limit
@@ -73,9 +80,24 @@ namespace OTH {
 		 StatGammaUni, // gamma with uniform prior
 		 StatGammaJeffreys}; // gamma with Jeffreys prior
 
+  // Precision of the generation of samples in pseudo-experiments
+  enum PrecType {PrecDouble, // double precision
+		 PrecMixed}; // scale factors of systematics in single precision, vectorised
+
   // Type of method for CLs(mu) computation
   enum MethType {MethDichotomy, // using log-dichotomy method
-		 MethExtrapol}; // using simple extrapolation
+		 MethExtrapol, // using simple extrapolation
+		 MethFit, // using a weighted fit of log(CLs) to all evaluations, with adaptive numbers of pseudo-experiments
+		 MethQuadrature}; // deterministic, using count distributions computed by quadrature (single channel only)
+
+  // Index from names or ids to positions in containers (hashed if C++11 is available)
+#if defined CPP11
+  typedef std::unordered_map<std::string,unsigned int> NameIndex;
+  typedef std::unordered_map<unsigned int,unsigned int> IdIndex;
+#else
+  typedef std::map<std::string,unsigned int> NameIndex;
+  typedef std::map<unsigned int,unsigned int> IdIndex;
+#endif
 }
 
 #endif // OTH_TYPES_H
@@ -0,0 +1,84 @@
+///////////////////////////////////////////////////////////////////////////////////
+// This file is part the software OpTHyLiC
+// Copyright © 2015 Laboratoire de Physique Corpusculaire de Clermont-Ferrand
+// Developpers: David Calvet, Emmanuel Busato, Timothée Theveneaux-Pelzer
+// Contact: opthylic@in2p3.fr
+//
+//     This program is free software: you can redistribute it and/or modify
+//     it under the terms of the GNU General Public License as published by
+//     the Free Software Foundation, either version 3 of the License, or
+//     (at your option) any later version.
+// 
+//     This program is distributed in the hope that it will be useful,
+//     but WITHOUT ANY WARRANTY; without even the implied warranty of
+//     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//     GNU General Public License for more details.
+// 
+//     You should have received a copy of the GNU General Public License
+//     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef OTH_VARIANCEREDUCTION_H
+#define OTH_VARIANCEREDUCTION_H
+
+#include <vector>
+
+namespace OTH {
+
+  // Estimation of CLs=P(LLRsb>=llr)/P(LLRb>=llr) for a reference llr with variance reduction.
+  // For each pseudo-experiment, the estimated probabilities may be replaced by conditional
+  // expectations (exact control variates with coefficient one), and control variates of null
+  // expectation give weights to the pseudo-experiments (regression estimator), the same weights
+  // holding for all estimated probabilities. Standard errors are estimated for independent draws,
+  // by antithetic pairs (consecutive pseudo-experiments) if requested, and with control variates.
+  class VarianceReduction {
+
+  public:
+
+    // linearised LLR fluctuations: Poisson for b and s+b, systematics for b and s+b
+    enum {CtrlPoissonB,CtrlPoissonSB,CtrlSystB,CtrlSystSB,nbControls};
+
+    VarianceReduction();
+
+    ~VarianceReduction();
+
+    void reset(const bool antithetic,const bool controlVariates,const int nbExp=0);
+
+    // passB and passSB tell whether the LLRs of the pseudo-experiment are above the reference llr,
+    // probB and probSB are their conditional probabilities (or the same values as 0 or 1)
+    void add(const bool passB,const bool passSB,const double probB,const double probSB,const double *controls);
+
+    inline unsigned int getSize() const {return m_probB.size();}
+
+    // weights of the pseudo-experiments for the control variate estimator (summing to 1)
+    void computeWeights(std::vector<double> &weights) const;
+    // the weight of pseudo-experiment i with controls x_i is (1-sum_k beta[k]*(x_i[k]-means[k]))/n
+    void computeWeightCoefficients(std::vector<double> &means,std::vector<double> &beta) const;
+
+    // CLs (with control variates if used), and its standard errors for independent draws,
+    // with antithetic pairs (if used) and with control variates (if used)
+    double estimateCLs(double &errIndep,double &errPlain,double &errControl) const;
+
+    // summary of the gain
+    void print() const;
+
+  private:
+    VarianceReduction(const VarianceReduction&);
+    VarianceReduction &operator=(const VarianceReduction&);
+
+    void computeMoments(std::vector<double> &means,std::vector<double> &cov) const;
+    void computeRatio(const std::vector<double> &probB,const std::vector<double> &probSB,
+		      std::vector<double> &g) const;
+    double computeError(const std::vector<double> &values,const bool antithetic) const;
+    static void solve(const std::vector<double> &cov,const std::vector<double> &rhs,std::vector<double> &x);
+
+    bool m_antithetic;
+    bool m_controlVariates;
+    std::vector<double> m_passB,m_passSB; // indicators
+    std::vector<double> m_probB,m_probSB; // conditional probabilities
+    std::vector<double> m_controls; // nbControls per pseudo-experiment
+  };
+
+}
+
+#endif // OTH_VARIANCEREDUCTION_H
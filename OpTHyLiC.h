@@ -22,6 +22,13 @@
 #define OPTHYLIC_H
 
 #include "OTHObserved.h"
+#include "OTHObservedMemo.h"
+#include "OTHVarianceReduction.h"
+#include "OTHExport.h"
+#include "OTHRunPlan.h"
+#include "OTHToyCache.h"
+#include "OTHSystImpact.h"
+#include "OTHPrecisionReport.h"
 #include "OTHChannel.h"
 
 class OpTHyLiC: public OTH::Base {
@@ -39,12 +46,36 @@ public:
   // make multiple input files from single input with shapes
   void makeInputsFromShapes(const std::string &channelName,const std::string &fileName,const bool removeFiles=true);
 
+  // bins of inputs with shapes of lowest s/b are merged into a single channel (or dropped),
+  // within a maximal relative loss of the expected sensitivity (see OTH::Shape::groupBins)
+  // 0 (default) keeps one channel per bin, must be called before adding channels
+  inline void setShapePruning(const double maxLoss) {m_shapeMaxLoss=maxLoss;}
+
+  // removal of the systematic uncertainties of samples whose largest effect on the yield is below
+  // threshold times the total (statistical and systematic) uncertainty of the sample, and of the
+  // nuisance parameters left unused, to be called once all channels are added and before generating
+  // pseudo-experiments: the removed uncertainties and the decrease of the total uncertainties
+  // of the samples are reported to out, returns the number of removed (sample, systematic) entries
+  unsigned int pruneSystematics(const double threshold,std::ostream &out=std::cout);
+
   // set confidence level of computed limits
   virtual void setConfLevel(const double cl);
 
+  // normal approximation of the Poisson counts of the channels above 1/tolerance^2 expected
+  // background events, for all channels (see OTH::Channel::setGaussianRegime), 0 (default) disables it
+  void setGaussianRegime(const double tolerance);
+
+  // filling of the histograms of systematics distributions of all channels (off by default, and enabled
+  // for a channel by the first call of OTH::Channel::getSigSystDistr or getBkgSystDistr), which disables
+  // the specialised generation of samples
+  void setSystDistrFilling(const bool fill);
+
   // setting of samples yields and uncertainties
   unsigned int addChannel(const std::string &name);
   unsigned int addChannel(const std::string &name,const std::string &fileName,const bool removeFiles=true);
+  // add several channels at once, input files being read concurrently if C++11 is available
+  unsigned int addChannels(const std::vector<std::string> &names,const std::vector<std::string> &fileNames,
+			   const bool removeFiles=true);
   
   // get pointer to specified channel, using its index
   OTH::Channel* getChannel(const unsigned int iChannel);
@@ -62,6 +93,67 @@ public:
   // must be called before trying to compute any CLs or p-value
   virtual void generateDistrLLR(const int nbExp);
 
+  // generation of the LLR distributions separately for each group of channels sharing no systematic
+  // uncertainty with the others, the combined distributions being obtained by convolution
+  // (more accurate tails for large combinations, with the same number of pseudo-experiments)
+  inline void setFactorisation(const bool factorise) {m_factorise=factorise;}
+
+  // variance reduction of the LLR distributions: antithetic pairs of opposite systematic variations,
+  // and control variates of null expectation (the Poisson fluctuation of the main channel replaced by its
+  // exact distribution, then linearised Poisson and systematic fluctuations of the LLRs weighting the
+  // pseudo-experiments), the gain for the observed events being printed after each generation
+  // (control variates are not used with the factorisation)
+  void setVarianceReduction(const bool antithetic,const bool controlVariates);
+  inline const OTH::VarianceReduction &getVarianceReduction() const {return m_varReduction;}
+
+  // incremental combination: the draws of the pseudo-experiments which do not depend on the signal
+  // strength are kept (see OTH::ToyCache), so that the following generations with the same number
+  // of pseudo-experiments only compute the LLRs, and only generate the draws of the channels added
+  // since then, with the same variations of the systematic uncertainties
+  // (the factorisation and the variance reduction are not used, channels must not be modified
+  // once their draws are kept, disabling it removes the draws)
+  void setIncremental(const bool incremental);
+  inline bool isIncremental() const {return m_incremental;}
+
+  // LLRs of each pseudo-experiment of the last generation are kept for the export (not available
+  // with the factorisation, and without their weights with control variates, a warning being printed)
+  inline void setToyRecording(const bool record) {m_recordToys=record;}
+
+  // common random numbers: the generator is reseeded for each pseudo-experiment and each channel,
+  // from seed (drawn from the generator if 0), so that models differing only by some systematic
+  // uncertainties draw the same random numbers, and a generation with the same signal strength
+  // gives the same pseudo-experiments (ignored by the factorisation and the incremental combination,
+  // a warning being printed)
+  void setCommonRandomNumbers(const bool common,const unsigned int seed=0);
+
+  // ranking of the systematic uncertainties by their impact on the expected (median) and observed
+  // limits: the limits are computed with each uncertainty removed, and fixed at +1 and -1 sigma,
+  // with nbExp common random numbers pseudo-experiments for all variants (see OTH::SystImpact)
+  // the 1+3*nbSyst variants are computed concurrently on nbThreads threads (0 for the number
+  // of cores) if C++11 is available, each of them with its own copy of the model
+  void computeSystImpacts(const int nbExp,std::vector<OTH::SystImpact> &impacts,int nbThreads=0);
+
+  // precision of the generation of samples: with PrecMixed, the scale factors of the systematic
+  // uncertainties are computed in single precision and vectorised (see OTH::ToyKernel), the
+  // statistical draws and the sums of LLRs staying in double precision
+  void setKernelPrecision(const OTH::PrecType precision);
+  inline OTH::PrecType getKernelPrecision() const {return m_precision;}
+
+  // comparison of the mixed and double precisions with nbExp pseudo-experiments with the signal
+  // strength mu: sample yields generated with the same variations and statistical draws, then
+  // LLRs and CLs of pseudo-experiments with common random numbers (see OTH::PrecisionReport)
+  // the histograms of systematics distributions are not filled meanwhile (the filling would bypass
+  // the kernels), the random generator, the precision and the options are restored afterwards, also
+  // if the validation fails, but the LLR distributions are the ones of the mixed precision
+  OTH::PrecisionReport validateMixedPrecision(const int nbExp,const double mu=1);
+
+  // copy of the model (channels, confidence level and normal approximation) with a new random
+  // generator of the same type and initial seed, to be deleted by the caller
+  OpTHyLiC *clone() const;
+
+  // groups of channels (indices) sharing no systematic uncertainty with other groups
+  std::vector< std::vector<unsigned int> > getCorrelationGroups() const;
+
   // computation of the p-value
   // the LLR distributions must have been generated before
   virtual double pValueData() const;
@@ -76,15 +168,52 @@ public:
   // (calls setSigStrength, generateDistrLLR and computeCLsData)
   virtual double generateForCLs(const double mu,const int nbExp,const int type);
 
+  // computation of the CLs for the limit type from the LLR distributions already generated
+  virtual double computeCLsFromDistr(const int type);
+
   // methods called for observed and expected (median, -+1 sigma, +-2 sigma) limit computation
+  // cls is the CLs at the returned limit (with MethFit, the value of the fit of log(CLs))
   virtual double sigStrengthExclusion(const OTH::LimitType type,const int nbExp,double &cls,
 				      const double muHint=1,const OTH::MethType method=OTH::MethDichotomy);
 
+  // prediction of the time, memory and pseudo-experiments of sigStrengthExclusion with nbExp
+  // pseudo-experiments, and of expectedSigStrengthExclusion with nbMu pseudo-data (if nbMu>0),
+  // from a calibration search with nbExpPilot pseudo-experiments per CLs evaluation
+  // the random generator is restored afterwards, so that the following results are unchanged,
+  // but the LLR distributions are the ones of the calibration
+  OTH::RunPlan planRun(const int nbExp,const int nbMu=0,const double clsPrecision=0,
+		       const int nbExpPilot=5000,const OTH::LimitType type=OTH::LimObserved);
+
   // computation of the distribution of the observed signal strengths if no signal exists
   // computation of the quantiles of this distribution (returns the median)
   // combining all channels
   double expectedSigStrengthExclusion(const int nbMu,const int nbExp);
 
+  // sequential stopping of expectedSigStrengthExclusion: every nbMuPerCheck pseudo-data, confidence
+  // intervals at confidence level cl of the five quantiles are computed from order statistics
+  // (see OTH::Algorithms::getQuantileIntervals), and the computation stops once all of them have a
+  // relative half-width below precision, nbMu being then a maximum (0 disables it)
+  void setExpectedPrecision(const double precision,const int nbMuPerCheck=1000,const double cl=0.95);
+  // relative half-widths of the confidence intervals of the five quantiles reached by the last
+  // computation of expected signal strengths, and number of pseudo-data it used
+  inline const std::vector<double> &getExpectedPrecision() const {return m_expAchieved;}
+  inline int getNbMuUsed() const {return m_expNbMuUsed;}
+
+  // periodic checkpoints of expectedSigStrengthExclusion, written every nbMuPerCheckpoint mus
+  // and at the end of the computation (an empty file name disables checkpoints)
+  void setCheckpoint(const std::string &fileName,const int nbMuPerCheckpoint=1000);
+
+  // continuation of an interrupted expectedSigStrengthExclusion from its last checkpoint
+  // the model and random engine type must be the same, results are identical to an uninterrupted run
+  double resumeExpectedSigStrengthExclusion(const std::string &fileName);
+
+  // use the mu values stored in a checkpoint of the same model as a warm start
+  // for the following calls of expectedSigStrengthExclusion (returns the number of loaded values)
+  unsigned int loadMuMemo(const std::string &fileName);
+
+  // fingerprint of the model (samples, systematics and methods), used to validate checkpoints
+  std::string getModelFingerprint() const;
+
   // print samples
   void printSamples() const;
 
@@ -102,6 +231,15 @@ public:
   // fileName contains the translation of systematics to LaTeX names
   void createSysteTables(std::ostream &latex,const std::string fileName,const int precision=2) const;
 
+  // appends all results available to the export, in blocks whose names start with prefix:
+  // LLRb and LLRsb histograms, toys (recorded LLRs), expMu and CLs distributions,
+  // muVsObs and CLsVsMu graphs, and searchTrace (CLs evaluations of the last limit search)
+  void exportResults(OTH::Export &exp,const std::string &prefix="") const;
+
+  // also deletes the histograms of the channels and of the systematic uncertainties, and releases the
+  // LLRs recorded with setToyRecording and the draws kept for setIncremental and variance reduction
+  virtual void releaseMemory();
+
   // get systematic uncertainties base distribution
   TH1 *getSystGaussDistr() const;
   
@@ -116,21 +254,73 @@ private:
   OpTHyLiC(const OpTHyLiC&);
   OpTHyLiC &operator=(const OpTHyLiC&);
 
-  bool isShape(const std::string &fileName) const;
+  OTH::Channel *newChannel(const std::string &name);
+  void addChannel(const std::string &name,const OTH::CardReader &card,const bool removeFiles);
   void setMuVsObs(const OTH::Observed &obs,const double mu);
+  void generateDistrLLRGroups(const std::vector< std::vector<unsigned int> > &groups,const int nbExp,
+			      const std::vector<double> &llrMins,const std::vector<double> &llrMaxs);
+  void generateDistrLLRReduced(const int nbExp);
+  void generateDistrLLRIncremental(const int nbExp);
+  // state of the model changed by validateMixedPrecision
+  struct ValidationState {
+    std::string rdmState; // saved random generator
+    OTH::PrecType precision;
+    double sigStrength,lastCLsb,lastCLb;
+    bool factorise,antithetic,controlVariates,incremental,recordToys,commonRandom;
+    unsigned int commonSeed;
+    OTH::ToyCache toyCache;
+    std::vector<bool> fillSystDistr; // for each channel
+  };
+  void computePrecisionReport(const int nbExp,const double mu,OTH::PrecisionReport &report);
+  void restoreValidationState(ValidationState &state);
+  void computeSystImpactVariant(const unsigned int variant,const int nbExp,const unsigned int seed,
+				double &expLimit,double &obsLimit) const;
+  void createExpectedHistos(const double mu0);
+  double expectedSigStrengthLoop(const int iFirst,const int nbMu,const int nbExp,const double mu0);
+  double updateExpectedPrecision(const int nbMuUsed);
+  void writeCheckpoint(const int iNext,const int nbMu,const int nbExp,const double mu0) const;
+  void readCheckpoint(const std::string &fileName,const bool memoOnly,int &iNext,int &nbMu,int &nbExp,double &mu0);
   void createYieldTable(const int nbExp,std::ostream &latex,const int precision) const;
+  void generateYieldQuantiles(const int nbExp,std::vector< std::vector<OTH::YieldWithUncert> > &yields) const;
 
   OTH::RdmGenerator *m_pRdmGen; // random number generator
+  int m_rdmType; // type of random number generator
   OTH::Systematics *m_pSyste; // list of systematic uncertainties
   OTH::PdfGenerator *m_pStatSampling; // sampling method for stat uncertainty
+  OTH::ToyKernel *m_pKernel; // specialised generation of samples
+  OTH::PrecType m_precision; // precision of m_pKernel
   std::deque<OTH::Channel*> m_pChannels; // channels
+  OTH::NameIndex m_channelIndex; // index of channels from their names
   double m_sigStrength; // signal strength (scale factor of signal)
   double m_sumMu; // to compute average mu
   int m_nbMu; // to compute average mu
+  bool m_factorise; // generation by independent groups of channels
+  double m_shapeMaxLoss; // maximal sensitivity loss when merging bins of shapes
+  double m_gaussTolerance; // accuracy of the normal approximation of Poisson counts
+  bool m_fillSystDistr; // histograms of systematics distributions filled
+  bool m_controlVariates; // weighting of pseudo-experiments by control variates
+  OTH::VarianceReduction m_varReduction; // pseudo-experiments kept for variance reduction
+  bool m_recordToys; // LLRs of pseudo-experiments kept for the export
+  std::vector<double> m_toyLLRb,m_toyLLRsb; // LLRs of the pseudo-experiments
+  bool m_incremental; // draws of pseudo-experiments kept for the following generations
+  OTH::ToyCache m_toyCache; // draws of pseudo-experiments independent of the signal strength
+  bool m_commonRandom; // generator reseeded for each pseudo-experiment and channel
+  unsigned int m_commonSeed; // base seed of the common random numbers
 
   // distributions
   std::vector<TH1*> m_pHs; // main histos
-  std::map<OTH::Observed,double> m_muObs; // values of mu_95 for given observed events
-  std::vector< std::map<OTH::Observed,OTH::MuVsObs> > m_muObsInterpol; // for interpolation
+  OTH::ObservedMemo m_muObs; // values of mu_95 for given observed events, and interpolation
+  OTH::ObservedMemo m_muObsWarm; // values of mu_95 loaded from a previous run
+
+  // sequential stopping of expected signal strengths
+  double m_expPrecision; // target relative half-width of the quantile intervals
+  int m_expCheckEvery; // pseudo-data between checks
+  double m_expIntervalCL; // confidence level of the quantile intervals
+  std::vector<double> m_expAchieved; // relative half-widths reached
+  int m_expNbMuUsed; // pseudo-data used
+
+  // checkpoints
+  std::string m_checkpointFile;
+  int m_checkpointEvery;
 };
 #endif // OPTHYLIC_H
@@ -0,0 +1,44 @@
+///////////////////////////////////////////////////////////////////////////////////
+// This file is part the software OpTHyLiC
+// Copyright © 2015 Laboratoire de Physique Corpusculaire de Clermont-Ferrand
+// Developpers: David Calvet, Emmanuel Busato, Timothée Theveneaux-Pelzer
+// Contact: opthylic@in2p3.fr
+//
+//     This program is free software: you can redistribute it and/or modify
+//     it under the terms of the GNU General Public License as published by
+//     the Free Software Foundation, either version 3 of the License, or
+//     (at your option) any later version.
+// 
+//     This program is distributed in the hope that it will be useful,
+//     but WITHOUT ANY WARRANTY; without even the implied warranty of
+//     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//     GNU General Public License for more details.
+// 
+//     You should have received a copy of the GNU General Public License
+//     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////////
+// Minimal replacement of ROOT basic types, only used when OpTHyLiC is built
+// without ROOT (see INSTALL --noroot)
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef OTH_NOROOT_RTYPES_H
+#define OTH_NOROOT_RTYPES_H
+
+typedef int Int_t;
+typedef unsigned int UInt_t;
+typedef double Double_t;
+typedef float Float_t;
+typedef bool Bool_t;
+
+const Bool_t kTRUE=true;
+const Bool_t kFALSE=false;
+
+// colors and markers are only kept for source compatibility
+enum EColor {kWhite=0,kBlack=1,kRed=632,kBlue=600};
+enum EMarkerStyle {kCircle=24};
+
+class TDirectory;
+
+#endif // OTH_NOROOT_RTYPES_H
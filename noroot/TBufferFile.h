@@ -0,0 +1,91 @@
+///////////////////////////////////////////////////////////////////////////////////
+// This file is part the software OpTHyLiC
+// Copyright © 2015 Laboratoire de Physique Corpusculaire de Clermont-Ferrand
+// Developpers: David Calvet, Emmanuel Busato, Timothée Theveneaux-Pelzer
+// Contact: opthylic@in2p3.fr
+//
+//     This program is free software: you can redistribute it and/or modify
+//     it under the terms of the GNU General Public License as published by
+//     the Free Software Foundation, either version 3 of the License, or
+//     (at your option) any later version.
+// 
+//     This program is distributed in the hope that it will be useful,
+//     but WITHOUT ANY WARRANTY; without even the implied warranty of
+//     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//     GNU General Public License for more details.
+// 
+//     You should have received a copy of the GNU General Public License
+//     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////////
+// Minimal replacement of ROOT TBuffer/TBufferFile classes (in memory buffer of
+// 32 bits words), only used when OpTHyLiC is built without ROOT (see INSTALL
+// --noroot)
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef OTH_NOROOT_TBUFFERFILE_H
+#define OTH_NOROOT_TBUFFERFILE_H
+
+#include <cstring>
+#include <vector>
+
+#include "Rtypes.h"
+
+class TBuffer {
+
+ public:
+
+  enum EMode {kRead=0,kWrite=1};
+
+  TBuffer(const EMode mode) : m_mode(mode),m_pos(0) {}
+
+  // reading buffer copied from the given memory (the memory is never adopted)
+  TBuffer(const EMode mode,const Int_t bufsiz,void *buf,const Bool_t=kTRUE) :
+    m_mode(mode),
+    m_data(static_cast<char*>(buf),static_cast<char*>(buf)+(bufsiz>0?bufsiz:0)),
+    m_pos(0)
+  {}
+
+  virtual ~TBuffer() {}
+
+  inline Bool_t IsReading() const {return kRead==m_mode;}
+  inline Bool_t IsWriting() const {return kWrite==m_mode;}
+  // number of bytes written, or read so far
+  inline Int_t Length() const {return IsWriting()?static_cast<Int_t>(m_data.size()):m_pos;}
+  inline Int_t BufferSize() const {return static_cast<Int_t>(m_data.size());}
+  inline char *Buffer() {return m_data.empty()?0:&m_data[0];}
+
+  inline void WriteFastArray(const UInt_t *ii,const Int_t n) {write(ii,n*sizeof(UInt_t));}
+  inline void ReadFastArray(UInt_t *ii,const Int_t n) {read(ii,n*sizeof(UInt_t));}
+  inline TBuffer &operator<<(const Int_t i) {write(&i,sizeof(i)); return *this;}
+  inline TBuffer &operator>>(Int_t &i) {read(&i,sizeof(i)); return *this;}
+
+ private:
+  inline void write(const void *p,const size_t n) {
+    const char *c=static_cast<const char*>(p);
+    m_data.insert(m_data.end(),c,c+n);
+  }
+  // reading beyond the end of the buffer gives zeros
+  inline void read(void *p,const size_t n) {
+    const size_t left=m_pos<static_cast<Int_t>(m_data.size())?m_data.size()-m_pos:0;
+    std::memset(p,0,n);
+    if (left) std::memcpy(p,&m_data[m_pos],n<left?n:left);
+    m_pos+=static_cast<Int_t>(n);
+  }
+
+  EMode m_mode;
+  std::vector<char> m_data;
+  Int_t m_pos;
+};
+
+class TBufferFile : public TBuffer {
+
+ public:
+
+  TBufferFile(const EMode mode) : TBuffer(mode) {}
+  TBufferFile(const EMode mode,const Int_t bufsiz,void *buf,const Bool_t adopt=kTRUE) : TBuffer(mode,bufsiz,buf,adopt) {}
+
+};
+
+#endif // OTH_NOROOT_TBUFFERFILE_H
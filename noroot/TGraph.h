@@ -0,0 +1,54 @@
+///////////////////////////////////////////////////////////////////////////////////
+// This file is part the software OpTHyLiC
+// Copyright © 2015 Laboratoire de Physique Corpusculaire de Clermont-Ferrand
+// Developpers: David Calvet, Emmanuel Busato, Timothée Theveneaux-Pelzer
+// Contact: opthylic@in2p3.fr
+//
+//     This program is free software: you can redistribute it and/or modify
+//     it under the terms of the GNU General Public License as published by
+//     the Free Software Foundation, either version 3 of the License, or
+//     (at your option) any later version.
+// 
+//     This program is distributed in the hope that it will be useful,
+//     but WITHOUT ANY WARRANTY; without even the implied warranty of
+//     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//     GNU General Public License for more details.
+// 
+//     You should have received a copy of the GNU General Public License
+//     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////////
+// Minimal replacement of ROOT TGraph class, only used when OpTHyLiC is built
+// without ROOT (see INSTALL --noroot)
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef OTH_NOROOT_TGRAPH_H
+#define OTH_NOROOT_TGRAPH_H
+
+#include <vector>
+
+#include "Rtypes.h"
+
+class TGraph {
+
+ public:
+
+  TGraph(const Int_t n=0);
+
+  virtual ~TGraph();
+
+  // the graph is extended if i is beyond its current size
+  void SetPoint(const Int_t i,const Double_t x,const Double_t y);
+
+  inline Int_t GetN() const {return m_x.size();}
+  inline Double_t *GetX() {return m_x.empty()?0:&m_x[0];}
+  inline Double_t *GetY() {return m_y.empty()?0:&m_y[0];}
+
+  inline void SetMarkerStyle(const Int_t) {}
+
+ private:
+  std::vector<Double_t> m_x,m_y;
+};
+
+#endif // OTH_NOROOT_TGRAPH_H
@@ -0,0 +1,108 @@
+///////////////////////////////////////////////////////////////////////////////////
+// This file is part the software OpTHyLiC
+// Copyright © 2015 Laboratoire de Physique Corpusculaire de Clermont-Ferrand
+// Developpers: David Calvet, Emmanuel Busato, Timothée Theveneaux-Pelzer
+// Contact: opthylic@in2p3.fr
+//
+//     This program is free software: you can redistribute it and/or modify
+//     it under the terms of the GNU General Public License as published by
+//     the Free Software Foundation, either version 3 of the License, or
+//     (at your option) any later version.
+// 
+//     This program is distributed in the hope that it will be useful,
+//     but WITHOUT ANY WARRANTY; without even the implied warranty of
+//     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//     GNU General Public License for more details.
+// 
+//     You should have received a copy of the GNU General Public License
+//     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////////
+// Minimal replacement of ROOT TH1 classes (fixed binning, 1D), only used when
+// OpTHyLiC is built without ROOT (see INSTALL --noroot)
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef OTH_NOROOT_TH1_H
+#define OTH_NOROOT_TH1_H
+
+#include <string>
+#include <vector>
+
+#include "Rtypes.h"
+
+class TH1 {
+
+ public:
+
+  TH1(const char *name,const char *title,const Int_t nbins,const Double_t xlow,const Double_t xup);
+
+  virtual ~TH1();
+
+  inline const char *GetName() const {return m_name.c_str();}
+  inline const char *GetTitle() const {return m_title.c_str();}
+
+  Int_t Fill(const Double_t x);
+  Int_t Fill(const Double_t x,const Double_t w);
+  Int_t FindBin(const Double_t x) const;
+
+  inline Int_t GetNbinsX() const {return m_nbins;}
+  inline Double_t GetBinContent(const Int_t bin) const {return (bin>=0 && bin<=m_nbins+1)?m_contents[bin]:0;}
+  void SetBinContent(const Int_t bin,const Double_t content);
+  Double_t GetBinError(const Int_t bin) const;
+  Double_t GetBinLowEdge(const Int_t bin) const;
+  Double_t GetBinCenter(const Int_t bin) const;
+  inline Double_t GetBinWidth(const Int_t) const {return (m_xup-m_xlow)/m_nbins;}
+  inline Double_t GetEntries() const {return m_entries;}
+  inline void SetEntries(const Double_t n) {m_entries=n;}
+  Double_t GetMean() const;
+
+  // sum of bin contents from 1 to nbins
+  Double_t Integral() const;
+  // sum of bin contents from binx1 to binx2, under/overflows included if requested
+  Double_t Integral(Int_t binx1,Int_t binx2) const;
+
+  void Scale(const Double_t c1=1);
+  void Reset();
+
+  // no directory, plotting or ownership management without ROOT
+  inline void SetDirectory(TDirectory*) {}
+  inline void SetLineColor(const Int_t) {}
+  inline void SetLineWidth(const Int_t) {}
+  inline void SetMarkerStyle(const Int_t) {}
+  inline static void AddDirectory(const Bool_t=kTRUE) {}
+  inline static Bool_t AddDirectoryStatus() {return kFALSE;}
+
+ protected:
+  // storage precision of the concrete class
+  virtual Double_t store(const Double_t content) const =0;
+
+ private:
+  TH1();
+
+  std::string m_name,m_title;
+  Int_t m_nbins;
+  Double_t m_xlow,m_xup;
+  Double_t m_entries;
+  std::vector<Double_t> m_contents; // including underflow (0) and overflow (nbins+1)
+};
+
+/// Histogram with single precision contents
+class TH1F : public TH1 {
+ public:
+  TH1F(const char *name,const char *title,const Int_t nbins,const Double_t xlow,const Double_t xup);
+  virtual ~TH1F();
+ protected:
+  virtual Double_t store(const Double_t content) const;
+};
+
+/// Histogram with integer contents
+class TH1I : public TH1 {
+ public:
+  TH1I(const char *name,const char *title,const Int_t nbins,const Double_t xlow,const Double_t xup);
+  virtual ~TH1I();
+ protected:
+  virtual Double_t store(const Double_t content) const;
+};
+
+#endif // OTH_NOROOT_TH1_H
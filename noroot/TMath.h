@@ -0,0 +1,50 @@
+///////////////////////////////////////////////////////////////////////////////////
+// This file is part the software OpTHyLiC
+// Copyright © 2015 Laboratoire de Physique Corpusculaire de Clermont-Ferrand
+// Developpers: David Calvet, Emmanuel Busato, Timothée Theveneaux-Pelzer
+// Contact: opthylic@in2p3.fr
+//
+//     This program is free software: you can redistribute it and/or modify
+//     it under the terms of the GNU General Public License as published by
+//     the Free Software Foundation, either version 3 of the License, or
+//     (at your option) any later version.
+// 
+//     This program is distributed in the hope that it will be useful,
+//     but WITHOUT ANY WARRANTY; without even the implied warranty of
+//     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//     GNU General Public License for more details.
+// 
+//     You should have received a copy of the GNU General Public License
+//     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////////
+// Minimal replacement of ROOT TMath namespace, only used when OpTHyLiC is built
+// without ROOT (see INSTALL --noroot)
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef OTH_NOROOT_TMATH_H
+#define OTH_NOROOT_TMATH_H
+
+#include <cmath>
+
+#include "Rtypes.h"
+
+namespace TMath {
+
+  inline Double_t Pi() {return 3.14159265358979323846;}
+  inline Double_t Abs(const Double_t x) {return std::fabs(x);}
+  inline Double_t Sqrt(const Double_t x) {return std::sqrt(x);}
+  inline Double_t Exp(const Double_t x) {return std::exp(x);}
+  inline Double_t Log(const Double_t x) {return std::log(x);}
+  inline Double_t Power(const Double_t x,const Double_t y) {return std::pow(x,y);}
+  inline Double_t Floor(const Double_t x) {return std::floor(x);}
+  inline Double_t Tan(const Double_t x) {return std::tan(x);}
+  inline Double_t Cos(const Double_t x) {return std::cos(x);}
+
+  Double_t Erf(const Double_t x);
+  Double_t ErfInverse(const Double_t x);
+  Double_t LnGamma(const Double_t x);
+}
+
+#endif // OTH_NOROOT_TMATH_H
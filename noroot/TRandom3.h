@@ -0,0 +1,63 @@
+///////////////////////////////////////////////////////////////////////////////////
+// This file is part the software OpTHyLiC
+// Copyright © 2015 Laboratoire de Physique Corpusculaire de Clermont-Ferrand
+// Developpers: David Calvet, Emmanuel Busato, Timothée Theveneaux-Pelzer
+// Contact: opthylic@in2p3.fr
+//
+//     This program is free software: you can redistribute it and/or modify
+//     it under the terms of the GNU General Public License as published by
+//     the Free Software Foundation, either version 3 of the License, or
+//     (at your option) any later version.
+// 
+//     This program is distributed in the hope that it will be useful,
+//     but WITHOUT ANY WARRANTY; without even the implied warranty of
+//     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//     GNU General Public License for more details.
+// 
+//     You should have received a copy of the GNU General Public License
+//     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////////
+// Minimal replacement of ROOT TRandom3 class, only used when OpTHyLiC is built
+// without ROOT (see INSTALL --noroot)
+// The uniform sequence is the one of ROOT (Mersenne Twister MT19937 with the same
+// seeding), Poisson draws use the same algorithm as ROOT, but Gaussian draws use
+// the Box-Muller transformation: Gaussian based sequences differ from ROOT ones.
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef OTH_NOROOT_TRANDOM3_H
+#define OTH_NOROOT_TRANDOM3_H
+
+#include "Rtypes.h"
+
+class TBuffer;
+
+class TRandom3 {
+
+ public:
+
+  TRandom3(const UInt_t seed=4357);
+
+  virtual ~TRandom3();
+
+  // seed 0 means a seed generated from the time and process
+  void SetSeed(const UInt_t seed=0);
+  inline UInt_t GetSeed() const {return m_seed;}
+
+  Double_t Rndm();
+  inline Double_t Uniform(const Double_t x1=1) {return x1*Rndm();}
+  Double_t Gaus(const Double_t mean=0,const Double_t sigma=1);
+  Int_t Poisson(const Double_t mean);
+
+  // serialization of the generator state (Mersenne twister table and position in it)
+  void Streamer(TBuffer &b);
+
+ private:
+  enum {kN=624};
+  UInt_t fMt[kN];
+  Int_t fCount624;
+  UInt_t m_seed;
+};
+
+#endif // OTH_NOROOT_TRANDOM3_H
@@ -0,0 +1,64 @@
+///////////////////////////////////////////////////////////////////////////////////
+// This file is part the software OpTHyLiC
+// Copyright © 2015 Laboratoire de Physique Corpusculaire de Clermont-Ferrand
+// Developpers: David Calvet, Emmanuel Busato, Timothée Theveneaux-Pelzer
+// Contact: opthylic@in2p3.fr
+//
+//     This program is free software: you can redistribute it and/or modify
+//     it under the terms of the GNU General Public License as published by
+//     the Free Software Foundation, either version 3 of the License, or
+//     (at your option) any later version.
+// 
+//     This program is distributed in the hope that it will be useful,
+//     but WITHOUT ANY WARRANTY; without even the implied warranty of
+//     MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//     GNU General Public License for more details.
+// 
+//     You should have received a copy of the GNU General Public License
+//     along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////////
+// Minimal replacement of ROOT TStopwatch class, only used when OpTHyLiC is built
+// without ROOT (see INSTALL --noroot)
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef OTH_NOROOT_TSTOPWATCH_H
+#define OTH_NOROOT_TSTOPWATCH_H
+
+#include <ctime>
+#include <sys/time.h>
+
+#include "Rtypes.h"
+
+class TStopwatch {
+
+ public:
+
+  TStopwatch() : m_cpuStart(0),m_cpuTime(0),m_realStart(0),m_realTime(0) {Start();}
+
+  inline void Start() {
+    m_cpuStart=std::clock();
+    m_realStart=now();
+  }
+  inline void Stop() {
+    m_cpuTime=static_cast<Double_t>(std::clock()-m_cpuStart)/CLOCKS_PER_SEC;
+    m_realTime=now()-m_realStart;
+  }
+  inline Double_t CpuTime() const {return m_cpuTime;}
+  inline Double_t RealTime() const {return m_realTime;}
+
+ private:
+  inline static Double_t now() {
+    timeval tv;
+    gettimeofday(&tv,0);
+    return tv.tv_sec+1e-6*tv.tv_usec;
+  }
+
+  std::clock_t m_cpuStart;
+  Double_t m_cpuTime;
+  Double_t m_realStart;
+  Double_t m_realTime;
+};
+
+#endif // OTH_NOROOT_TSTOPWATCH_H